@@ -12,6 +12,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/pm/device.h>
+#include <baro/baro_alt.h>
 
 #include "bmp390.h"
 
@@ -70,6 +71,26 @@ static inline int bmp388_reg_write(const struct device *dev, uint8_t reg,
 	return cfg->bus_io->write(&cfg->bus, reg, val);
 }
 
+static int bmp388_reg_write_pairs(const struct device *dev,
+				  const uint8_t *pairs, int size)
+{
+	const struct bmp388_config *cfg = dev->config;
+	int rc;
+
+	if (cfg->bus_io->write_pairs != NULL) {
+		return cfg->bus_io->write_pairs(&cfg->bus, pairs, size);
+	}
+
+	for (int i = 0; i + 1 < size; i += 2) {
+		rc = cfg->bus_io->write(&cfg->bus, pairs[i], pairs[i + 1]);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
 int bmp388_reg_field_update(const struct device *dev,
 			    uint8_t reg,
 			    uint8_t mask,
@@ -216,17 +237,109 @@ static int bmp388_attr_set(const struct device *dev,
 	return ret;
 }
 
-static int bmp388_sample_fetch(const struct device *dev,
-			       enum sensor_channel chan)
+#ifdef CONFIG_NRFMODULE_BMP390_FORCED_MODE
+/* Re-polls allowed when the chip's oscillator runs slower than the maximum. */
+#define BMP390_FORCED_RETRIES 4
+
+static uint32_t bmp390_conv_time_us(const struct bmp388_data *data)
 {
-	struct bmp388_data *bmp3xx = dev->data;
-	uint8_t raw[BMP388_SAMPLE_BUFFER_SIZE];
-	int ret = 0;
+	return BMP388_CONV_TIME_BASE_US +
+	       BMP388_CONV_TIME_PRESS_US +
+	       (BMP388_CONV_TIME_PER_OSR_US << data->osr_pressure) +
+	       BMP388_CONV_TIME_TEMP_US +
+	       (BMP388_CONV_TIME_PER_OSR_US << data->osr_temp);
+}
 
-	__ASSERT_NO_MSG(chan == SENSOR_CHAN_ALL);
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
+/* Whether data-ready can end the wait: the instance has an INT pin and the
+ * caller is not the work queue whose handler gives the semaphore.
+ */
+static bool bmp390_forced_irq(const struct device *dev)
+{
+	const struct bmp388_config *cfg = dev->config;
+
+	return cfg->gpio_int.port != NULL &&
+	       k_current_get() != k_work_queue_thread_get(&k_sys_work_q);
+}
+#endif
+
+/* Trigger one conversion, wait for data-ready (or sleep for its computed
+ * duration), then read STATUS and the data registers in a single burst into
+ * raw[0..6].
+ */
+static int bmp390_forced_read(const struct device *dev, uint8_t *raw)
+{
+	struct bmp388_data *data = dev->data;
+	uint32_t wait_us = bmp390_conv_time_us(data);
+	int ret;
+
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
+	const bool irq = bmp390_forced_irq(dev);
+
+	if (irq) {
+		k_sem_reset(&data->forced_sem);
+	}
+#endif
+
+	ret = bmp388_reg_write(dev, BMP388_REG_PWR_CTRL, BMP388_PWR_CTRL_FORCED);
+	if (ret < 0) {
+		return ret;
+	}
+
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
+	/* Done when data-ready says so. A missed interrupt costs the computed
+	 * time plus one oversampling step, then STATUS polling takes over.
+	 */
+	if (irq) {
+		(void)k_sem_take(&data->forced_sem,
+				 K_USEC(wait_us + BMP388_CONV_TIME_PER_OSR_US));
+		wait_us = 0;
+	}
+#endif
+
+	for (int i = 0; i <= BMP390_FORCED_RETRIES; i++) {
+		if (wait_us > 0) {
+			k_usleep(wait_us);
+		}
+
+		ret = bmp388_reg_read(dev, BMP388_REG_STATUS, raw,
+				      BMP388_SAMPLE_BUFFER_SIZE + 1);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if ((raw[0] & BMP388_STATUS_DRDY_PRESS) &&
+		    (raw[0] & BMP388_STATUS_DRDY_TEMP)) {
+			return 0;
+		}
+
+		/* Conversion is late: re-check in small slices. */
+		wait_us = BMP388_CONV_TIME_PER_OSR_US / 4;
+	}
+
+	LOG_DBG("Forced conversion did not complete.");
+	return -EAGAIN;
+}
+#endif
+
+int bmp388_sample_fetch_helper(const struct device *dev,
+			       struct bmp388_sample *sample)
+{
+	uint8_t raw[BMP388_SAMPLE_BUFFER_SIZE + 1];
+	const uint8_t *data = raw;
+	int ret = 0;
 
 	pm_device_busy_set(dev);
 
+#ifdef CONFIG_NRFMODULE_BMP390_FORCED_MODE
+	ret = bmp390_forced_read(dev, raw);
+	if (ret < 0) {
+		goto error;
+	}
+
+	/* raw[0] is STATUS */
+	data = &raw[1];
+#else
 	/* Wait for status to indicate that data is ready. */
 	raw[0] = 0U;
 	while ((raw[0] & BMP388_STATUS_DRDY_PRESS) == 0U) {
@@ -243,111 +356,128 @@ static int bmp388_sample_fetch(const struct device *dev,
 	if (ret < 0) {
 		goto error;
 	}
+#endif
 
 	/* convert samples to 32bit values */
-	bmp3xx->sample.press = sys_get_le24(&raw[0]);
-	bmp3xx->sample.raw_temp = sys_get_le24(&raw[3]);
-	bmp3xx->sample.comp_temp = 0;
+	sample->press = sys_get_le24(&data[0]);
+	sample->raw_temp = sys_get_le24(&data[3]);
+	sample->comp_valid = false;
 
 error:
 	pm_device_busy_clear(dev);
 	return ret;
 }
 
-static void bmp388_compensate_temp(struct bmp388_data *data)
+static int bmp388_sample_fetch(const struct device *dev,
+			       enum sensor_channel chan)
 {
-	/* Adapted from:
-	 * https://github.com/BoschSensortec/BMP3-Sensor-API/blob/master/bmp3.c
-	 */
+	struct bmp388_data *bmp3xx = dev->data;
 
-	int64_t partial_data1;
-	int64_t partial_data2;
-	int64_t partial_data3;
-	int64_t partial_data4;
-	int64_t partial_data5;
+	__ASSERT_NO_MSG(chan == SENSOR_CHAN_ALL);
 
-	struct bmp388_cal_data *cal = &data->cal;
+	return bmp388_sample_fetch_helper(dev, &bmp3xx->sample);
+}
 
-	partial_data1 = ((int64_t)data->sample.raw_temp - (256 * cal->t1));
-	partial_data2 = cal->t2 * partial_data1;
-	partial_data3 = (partial_data1 * partial_data1);
-	partial_data4 = (int64_t)partial_data3 * cal->t3;
-	partial_data5 = ((int64_t)(partial_data2 * 262144) + partial_data4);
+#ifdef CONFIG_NRFMODULE_I2C_BATCH
+static void bmp390_batch_done(struct i2c_batch_read *rd)
+{
+	struct bmp388_data *data = CONTAINER_OF(rd, struct bmp388_data, batch_rd);
+
+	if (rd->err < 0) {
+		LOG_ERR("Batched read failed (%d).", rd->err);
+		return;
+	}
 
-	/* Store for pressure calculation */
-	data->sample.comp_temp = partial_data5 / 4294967296;
+	data->sample.press = sys_get_le24(&data->batch_raw[0]);
+	data->sample.raw_temp = sys_get_le24(&data->batch_raw[3]);
+	data->sample.comp_valid = false;
 }
 
-static int bmp388_temp_channel_get(const struct device *dev,
-				   struct sensor_value *val)
+/* Filled once at init: while the read is queued or running the batch owns
+ * it, so bmp390_batch_add() must not touch its fields. */
+static void bmp390_batch_setup(const struct device *dev)
 {
+#if defined(BMP3XX_USE_I2C_BUS)
+	const struct bmp388_config *cfg = dev->config;
 	struct bmp388_data *data = dev->data;
 
-	if (data->sample.comp_temp == 0) {
-		bmp388_compensate_temp(data);
+	if (cfg->bus_io != &bmp388_bus_io_i2c) {
+		return;
 	}
 
-	int64_t tmp = (data->sample.comp_temp * 250000) / 16384;
+	/* Normal mode: DATA0..5 always hold the latest conversion. */
+	data->batch_rd.addr = cfg->bus.i2c.addr;
+	data->batch_rd.reg = BMP388_REG_DATA0;
+	data->batch_rd.len = BMP388_SAMPLE_BUFFER_SIZE;
+	data->batch_rd.buf = data->batch_raw;
+	data->batch_rd.done = bmp390_batch_done;
+#else
+	ARG_UNUSED(dev);
+#endif
+}
 
-	val->val1 = tmp / 1000000;
-	val->val2 = tmp % 1000000;
+int bmp390_batch_add(const struct device *dev, struct i2c_batch *batch)
+{
+#if defined(BMP3XX_USE_I2C_BUS) && !defined(CONFIG_NRFMODULE_BMP390_FORCED_MODE)
+	const struct bmp388_config *cfg = dev->config;
+	struct bmp388_data *data = dev->data;
 
-	return 0;
+	if (cfg->bus_io != &bmp388_bus_io_i2c) {
+		return -ENOTSUP;
+	}
+	if (batch->bus != cfg->bus.i2c.bus) {
+		return -EINVAL;
+	}
+
+	return i2c_batch_add(batch, &data->batch_rd);
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(batch);
+
+	return -ENOTSUP;
+#endif
 }
+#endif /* CONFIG_NRFMODULE_I2C_BATCH */
 
-static uint64_t bmp388_compensate_press(struct bmp388_data *data)
+void bmp390_compensate(const struct bmp390_comp *comp, uint32_t raw_press,
+		       uint32_t raw_temp, uint32_t *press_cpa, int32_t *temp_udegc)
 {
-	/* Adapted from:
-	 * https://github.com/BoschSensortec/BMP3-Sensor-API/blob/master/bmp3.c
-	 */
+#ifdef CONFIG_NRFMODULE_BMP390_FLOAT_COMP
+	float temp = bmp390_compensate_temp_f(&comp->cal, raw_temp);
+	float press = bmp390_compensate_press_f(&comp->cal, raw_press, temp);
 
-	int64_t partial_data1;
-	int64_t partial_data2;
-	int64_t partial_data3;
-	int64_t partial_data4;
-	int64_t partial_data5;
-	int64_t partial_data6;
-	int64_t offset;
-	int64_t sensitivity;
-	uint64_t comp_press;
-
-	struct bmp388_cal_data *cal = &data->cal;
-
-	int64_t t_lin = data->sample.comp_temp;
-	uint32_t raw_pressure = data->sample.press;
-
-	partial_data1 = t_lin * t_lin;
-	partial_data2 = partial_data1 / 64;
-	partial_data3 = (partial_data2 * t_lin) / 256;
-	partial_data4 = (cal->p8 * partial_data3) / 32;
-	partial_data5 = (cal->p7 * partial_data1) * 16;
-	partial_data6 = (cal->p6 * t_lin) * 4194304;
-	offset = (cal->p5 * 140737488355328) + partial_data4 + partial_data5 +
-		 partial_data6;
-	partial_data2 = (cal->p4 * partial_data3) / 32;
-	partial_data4 = (cal->p3 * partial_data1) * 4;
-	partial_data5 = (cal->p2 - 16384) * t_lin * 2097152;
-	sensitivity = ((cal->p1 - 16384) * 70368744177664) + partial_data2 +
-		      partial_data4 + partial_data5;
-	partial_data1 = (sensitivity / 16777216) * raw_pressure;
-	partial_data2 = cal->p10 * t_lin;
-	partial_data3 = partial_data2 + (65536 * cal->p9);
-	partial_data4 = (partial_data3 * raw_pressure) / 8192;
-	/* Dividing by 10 followed by multiplying by 10 to avoid overflow caused
-	 * (raw_pressure * partial_data4)
-	 */
-	partial_data5 = (raw_pressure * (partial_data4 / 10)) / 512;
-	partial_data5 = partial_data5 * 10;
-	partial_data6 = ((int64_t)raw_pressure * (int64_t)raw_pressure);
-	partial_data2 = (cal->p11 * partial_data6) / 65536;
-	partial_data3 = (partial_data2 * raw_pressure) / 128;
-	partial_data4 = (offset / 4) + partial_data1 + partial_data5 +
-			partial_data3;
-
-	comp_press = (((uint64_t)partial_data4 * 25) / (uint64_t)1099511627776);
-
-	/* returned value is in hundredths of Pa. */
-	return comp_press;
+	*press_cpa = (press > 0.0f) ? (uint32_t)(press * 100.0f + 0.5f) : 0U;
+	*temp_udegc = (int32_t)(temp * 1000000.0f);
+#else
+	int64_t t_lin = bmp388_compensate_temp(&comp->cal, raw_temp);
+
+	*press_cpa = (uint32_t)bmp388_compensate_press(&comp->cal, raw_press, t_lin);
+	*temp_udegc = (int32_t)((t_lin * 250000) / 16384);
+#endif
+}
+
+static void bmp388_compensate_sample(struct bmp388_data *data)
+{
+	struct bmp388_sample *sample = &data->sample;
+
+	if (!sample->comp_valid) {
+		bmp390_compensate(&data->comp, sample->press, sample->raw_temp,
+				  &sample->comp_press, &sample->comp_temp);
+		sample->comp_valid = true;
+	}
+}
+
+static int bmp388_temp_channel_get(const struct device *dev,
+				   struct sensor_value *val)
+{
+	struct bmp388_data *data = dev->data;
+
+	bmp388_compensate_sample(data);
+
+	val->val1 = data->sample.comp_temp / 1000000;
+	val->val2 = data->sample.comp_temp % 1000000;
+
+	return 0;
 }
 
 static int bmp388_press_channel_get(const struct device *dev,
@@ -355,20 +485,34 @@ static int bmp388_press_channel_get(const struct device *dev,
 {
 	struct bmp388_data *data = dev->data;
 
-	if (data->sample.comp_temp == 0) {
-		bmp388_compensate_temp(data);
-	}
+	bmp388_compensate_sample(data);
 
-	uint64_t tmp = bmp388_compensate_press(data);
-
-	/* tmp is in hundredths of Pa. Convert to kPa as specified in sensor
-	 * interface.
+	/* comp_press is in hundredths of Pa. Convert to kPa as specified in
+	 * sensor interface.
 	 */
-	val->val1 = tmp / 100000;
-	val->val2 = (tmp % 100000) * 10;
+	val->val1 = data->sample.comp_press / 100000;
+	val->val2 = (data->sample.comp_press % 100000) * 10;
+
+	return 0;
+}
+
+#ifdef CONFIG_NRFMODULE_BARO_ALT
+static int bmp390_alt_channel_get(const struct device *dev,
+				  struct sensor_value *val)
+{
+	struct bmp388_data *data = dev->data;
+	int32_t alt_mm;
+
+	bmp388_compensate_sample(data);
+
+	/* Pressure altitude (ISA, 1013.25 hPa), in meters. */
+	alt_mm = baro_alt_mm(data->sample.comp_press, BARO_ALT_P0_STD_CPA);
+	val->val1 = alt_mm / 1000;
+	val->val2 = (alt_mm % 1000) * 1000;
 
 	return 0;
 }
+#endif
 
 static int bmp388_channel_get(const struct device *dev,
 			      enum sensor_channel chan,
@@ -384,6 +528,12 @@ static int bmp388_channel_get(const struct device *dev,
 		bmp388_temp_channel_get(dev, val);
 		break;
 
+#ifdef CONFIG_NRFMODULE_BARO_ALT
+	case SENSOR_CHAN_ALTITUDE:
+		bmp390_alt_channel_get(dev, val);
+		break;
+#endif
+
 	default:
 		LOG_DBG("Channel not supported.");
 		return -ENOTSUP;
@@ -395,19 +545,42 @@ static int bmp388_channel_get(const struct device *dev,
 static int bmp388_get_calibration_data(const struct device *dev)
 {
 	struct bmp388_data *data = dev->data;
-	struct bmp388_cal_data *cal = &data->cal;
+	struct bmp388_cal_data cal;
+
+	if (data->cal_valid) {
+		uint16_t t1;
 
-	if (bmp388_reg_read(dev, BMP388_REG_CALIB0, (uint8_t *)cal, sizeof(*cal)) < 0) {
+		/* Cheap re-validation: the first word must still match. */
+		if (bmp388_reg_read(dev, BMP388_REG_CALIB0, (uint8_t *)&t1, sizeof(t1)) < 0) {
+			return -EIO;
+		}
+		if (sys_le16_to_cpu(t1) == data->cal_t1) {
+			return 0;
+		}
+		LOG_WRN("Calibration changed, re-reading.");
+		data->cal_valid = false;
+	}
+
+	if (bmp388_reg_read(dev, BMP388_REG_CALIB0, (uint8_t *)&cal, sizeof(cal)) < 0) {
 		return -EIO;
 	}
 
-	cal->t1 = sys_le16_to_cpu(cal->t1);
-	cal->t2 = sys_le16_to_cpu(cal->t2);
-	cal->p1 = (int16_t)sys_le16_to_cpu(cal->p1);
-	cal->p2 = (int16_t)sys_le16_to_cpu(cal->p2);
-	cal->p5 = sys_le16_to_cpu(cal->p5);
-	cal->p6 = sys_le16_to_cpu(cal->p6);
-	cal->p9 = (int16_t)sys_le16_to_cpu(cal->p9);
+	cal.t1 = sys_le16_to_cpu(cal.t1);
+	cal.t2 = sys_le16_to_cpu(cal.t2);
+	cal.p1 = (int16_t)sys_le16_to_cpu(cal.p1);
+	cal.p2 = (int16_t)sys_le16_to_cpu(cal.p2);
+	cal.p5 = sys_le16_to_cpu(cal.p5);
+	cal.p6 = sys_le16_to_cpu(cal.p6);
+	cal.p9 = (int16_t)sys_le16_to_cpu(cal.p9);
+
+#ifdef CONFIG_NRFMODULE_BMP390_FLOAT_COMP
+	/* Scale once here so each sample is a few multiply-adds. */
+	bmp390_cal_to_float(&cal, &data->comp.cal);
+#else
+	data->comp.cal = cal;
+#endif
+	data->cal_t1 = cal.t1;
+	data->cal_valid = true;
 
 	return 0;
 }
@@ -422,7 +595,7 @@ static int bmp388_pm_action(const struct device *dev,
 
 	switch (action) {
 	case PM_DEVICE_ACTION_RESUME:
-		reg_val = BMP388_PWR_CTRL_MODE_NORMAL;
+		reg_val = BMP390_PWR_CTRL_MODE_ACTIVE;
 		break;
 	case PM_DEVICE_ACTION_SUSPEND:
 		reg_val = BMP388_PWR_CTRL_MODE_SLEEP;
@@ -434,8 +607,13 @@ static int bmp388_pm_action(const struct device *dev,
 		 * TURN_ON re-init is why this driver is vendored vs. the stock one. */
 		return bmp388_chip_init(dev);
 	case PM_DEVICE_ACTION_TURN_OFF:
-		/* Rail about to be gated; the chip loses power, nothing to do. */
+		/* Rail about to be gated; the chip loses power. Mask the INT pin
+		 * so the collapsing rail cannot fire it. */
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
+		return bmp390_int_disable(dev);
+#else
 		return 0;
+#endif
 	default:
 		return -ENOTSUP;
 	}
@@ -454,11 +632,15 @@ static int bmp388_pm_action(const struct device *dev,
 
 static DEVICE_API(sensor, bmp388_api) = {
 	.attr_set = bmp388_attr_set,
-#ifdef CONFIG_BMP388_TRIGGER
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
 	.trigger_set = bmp388_trigger_set,
 #endif
 	.sample_fetch = bmp388_sample_fetch,
 	.channel_get = bmp388_channel_get,
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = bmp390_submit,
+	.get_decoder = bmp390_get_decoder,
+#endif
 };
 
 static int bmp388_chip_init(const struct device *dev)
@@ -478,7 +660,13 @@ static int bmp388_chip_init(const struct device *dev)
 		return -EIO;
 	}
 
-	k_busy_wait(2000);
+	/* Sleep through the reset when a thread can; this runs on every
+	 * TURN_ON, i.e. each time the sensor rail is ungated. */
+	if (k_is_pre_kernel() || k_is_in_isr()) {
+		k_busy_wait(BMP388_SOFT_RESET_TIME_MS * USEC_PER_MSEC);
+	} else {
+		k_msleep(BMP388_SOFT_RESET_TIME_MS);
+	}
 
 	if (bmp388_reg_read(dev, BMP388_REG_CHIPID, &val, 1) < 0) {
 		LOG_ERR("Failed to read chip id.");
@@ -490,38 +678,27 @@ static int bmp388_chip_init(const struct device *dev)
 		return -ENODEV;
 	}
 
-	/* Read calibration data */
+	/* Read calibration data (cached after the first read) */
 	if (bmp388_get_calibration_data(dev) < 0) {
 		LOG_ERR("Failed to read calibration data.");
 		return -EIO;
 	}
 
-	/* Set ODR */
-	if (bmp388_reg_field_update(dev, BMP388_REG_ODR, BMP388_ODR_MASK, bmp3xx->odr) < 0) {
-		LOG_ERR("Failed to set ODR.");
-		return -EIO;
-	}
-
-	/* Set OSR */
-	val = (bmp3xx->osr_pressure << BMP388_OSR_PRESSURE_POS);
-	val |= (bmp3xx->osr_temp << BMP388_OSR_TEMP_POS);
-	if (bmp388_reg_write(dev, BMP388_REG_OSR, val) < 0) {
-		LOG_ERR("Failed to set OSR.");
-		return -EIO;
-	}
-
-	/* Set IIR filter coefficient */
-	val = (cfg->iir_filter << BMP388_IIR_FILTER_POS) & BMP388_IIR_FILTER_MASK;
-	if (bmp388_reg_write(dev, BMP388_REG_CONFIG, val) < 0) {
-		LOG_ERR("Failed to set IIR coefficient.");
-		return -EIO;
-	}
-
-	/* Enable sensors and normal mode*/
-	if (bmp388_reg_write(dev,
-			     BMP388_REG_PWR_CTRL,
-			     BMP388_PWR_CTRL_ON) < 0) {
-		LOG_ERR("Failed to enable sensors.");
+	/* Set ODR, OSR and IIR filter coefficient, then enable sensors and
+	 * normal mode (sleep mode for forced-mode builds), in one transfer.
+	 * The reset cleared the reserved bits, so no read-modify-write.
+	 */
+	const uint8_t config[] = {
+		BMP388_REG_ODR, bmp3xx->odr & BMP388_ODR_MASK,
+		BMP388_REG_OSR, (bmp3xx->osr_pressure << BMP388_OSR_PRESSURE_POS) |
+				(bmp3xx->osr_temp << BMP388_OSR_TEMP_POS),
+		BMP388_REG_CONFIG, (cfg->iir_filter << BMP388_IIR_FILTER_POS) &
+				   BMP388_IIR_FILTER_MASK,
+		BMP388_REG_PWR_CTRL, BMP388_PWR_CTRL_ON,
+	};
+
+	if (bmp388_reg_write_pairs(dev, config, sizeof(config)) < 0) {
+		LOG_ERR("Failed to configure sensor.");
 		return -EIO;
 	}
 
@@ -537,10 +714,19 @@ static int bmp388_chip_init(const struct device *dev)
 		return -EINVAL;
 	}
 
-#ifdef CONFIG_BMP388_TRIGGER
-	if (cfg->gpio_int.port != NULL && bmp388_trigger_mode_init(dev) < 0) {
-		LOG_ERR("Cannot set up trigger mode.");
-		return -EINVAL;
+#ifdef CONFIG_NRFMODULE_BMP390_FIFO
+	/* A rail power-cycle wiped the FIFO config; restore an active batch. */
+	if (bmp3xx->fifo_wtm_frames != 0 && bmp390_fifo_apply(dev) < 0) {
+		LOG_ERR("Failed to restore FIFO.");
+		return -EIO;
+	}
+#endif
+
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
+	/* Re-enable whichever interrupt was active before the power-cycle. */
+	if (bmp390_int_apply(dev) < 0) {
+		LOG_ERR("Failed to restore interrupt.");
+		return -EIO;
 	}
 #endif
 
@@ -556,6 +742,16 @@ static int bmp388_init(const struct device *dev)
 		LOG_DBG("bus check failed");
 		return -ENODEV;
 	}
+#ifdef CONFIG_NRFMODULE_I2C_BATCH
+	bmp390_batch_setup(dev);
+#endif
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
+	/* GPIO and work item once; the chip side is (re)armed in chip init. */
+	if (bmp388_trigger_mode_init(dev) < 0) {
+		LOG_ERR("Cannot set up trigger mode.");
+		return -EINVAL;
+	}
+#endif
 #if defined(CONFIG_PM_DEVICE)
 	return pm_device_driver_init(dev, bmp388_pm_action);
 #else
@@ -578,7 +774,7 @@ static int bmp388_init(const struct device *dev)
 		    (BMP388_CONFIG_I2C(inst)),	\
 		    (BMP388_CONFIG_SPI(inst)))
 
-#if defined(CONFIG_BMP388_TRIGGER)
+#if defined(CONFIG_NRFMODULE_BMP390_TRIGGER)
 #define BMP388_INT_CFG(inst) \
 	.gpio_int = GPIO_DT_SPEC_INST_GET_OR(inst, int_gpios, {0}),
 #else
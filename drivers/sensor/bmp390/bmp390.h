@@ -18,23 +18,29 @@
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/rtio/rtio.h>
 #include <zephyr/sys/util.h>
 
-#define DT_DRV_COMPAT  bosch_bmp388
-#define BMP388_BUS_SPI DT_ANY_INST_ON_BUS_STATUS_OKAY(spi)
-#define BMP388_BUS_I2C DT_ANY_INST_ON_BUS_STATUS_OKAY(i2c)
-#undef DT_DRV_COMPAT
+#include <drivers/sensor/bmp390_extended.h>
+#ifdef CONFIG_NRFMODULE_I2C_BATCH
+#include <bus/i2c_batch.h>
+#endif
+
+#include "bmp390_comp.h"
+#include "bmp390_fifo_parse.h"
 
-#define DT_DRV_COMPAT  bosch_bmp390
-#define BMP390_BUS_SPI DT_ANY_INST_ON_BUS_STATUS_OKAY(spi)
-#define BMP390_BUS_I2C DT_ANY_INST_ON_BUS_STATUS_OKAY(i2c)
-#undef DT_DRV_COMPAT
+/* Explicit compatibles: DT_ANY_INST_ON_BUS_STATUS_OKAY() would expand against
+ * whatever DT_DRV_COMPAT is at the point of use, not here. */
+#define BMP388_BUS_SPI DT_HAS_COMPAT_ON_BUS_STATUS_OKAY(bosch_bmp388, spi)
+#define BMP388_BUS_I2C DT_HAS_COMPAT_ON_BUS_STATUS_OKAY(bosch_bmp388, i2c)
+#define BMP390_BUS_SPI DT_HAS_COMPAT_ON_BUS_STATUS_OKAY(bosch_bmp390, spi)
+#define BMP390_BUS_I2C DT_HAS_COMPAT_ON_BUS_STATUS_OKAY(bosch_bmp390, i2c)
 
-#if defined(BMP388_BUS_SPI) || defined(BMP390_BUS_SPI)
+#if BMP388_BUS_SPI || BMP390_BUS_SPI
 #define BMP3XX_USE_SPI_BUS
 #endif
 
-#if defined(BMP388_BUS_I2C) || defined(BMP390_BUS_I2C)
+#if BMP388_BUS_I2C || BMP390_BUS_I2C
 #define BMP3XX_USE_I2C_BUS
 #endif
 
@@ -52,11 +58,16 @@ typedef int (*bmp388_reg_read_fn)(const union bmp388_bus *bus,
 				  uint8_t start, uint8_t *buf, int size);
 typedef int (*bmp388_reg_write_fn)(const union bmp388_bus *bus,
 				   uint8_t reg, uint8_t val);
+typedef int (*bmp388_reg_write_pairs_fn)(const union bmp388_bus *bus,
+					 const uint8_t *pairs, int size);
 
 struct bmp388_bus_io {
 	bmp388_bus_check_fn check;
 	bmp388_reg_read_fn read;
 	bmp388_reg_write_fn write;
+	/* Optional: {reg, val} pairs in one transfer (datasheet 5.2/5.3
+	 * multiple-byte write). NULL falls back to one write per pair. */
+	bmp388_reg_write_pairs_fn write_pairs;
 };
 
 #ifdef BMP3XX_USE_SPI_BUS
@@ -112,7 +123,30 @@ extern const struct bmp388_bus_io bmp388_bus_io_i2c;
 #define BMP388_STATUS_DRDY_PRESS BIT(5)
 #define BMP388_STATUS_DRDY_TEMP  BIT(6)
 
+/* BMP388_REG_INT_STATUS */
+#define BMP388_INT_STATUS_FWM  BIT(0)
+#define BMP388_INT_STATUS_FFULL BIT(1)
+#define BMP388_INT_STATUS_DRDY BIT(3)
+
+/* BMP388_REG_FIFO_CONFIG1 */
+#define BMP388_FIFO_CONFIG1_MODE        BIT(0)
+#define BMP388_FIFO_CONFIG1_STOP_ON_FULL BIT(1)
+#define BMP388_FIFO_CONFIG1_TIME_EN     BIT(2)
+#define BMP388_FIFO_CONFIG1_PRESS_EN    BIT(3)
+#define BMP388_FIFO_CONFIG1_TEMP_EN     BIT(4)
+
+/* BMP388_REG_FIFO_CONFIG2 */
+#define BMP388_FIFO_CONFIG2_DATA_SELECT_FILTERED (0x01 << 3)
+
+/* FIFO frame layout and sensortime are in bmp390_fifo_parse.h. */
+#define BMP388_FIFO_SIZE           512
+#define BMP388_FIFO_WTM_MAX        0x1FF
+
 /* BMP388_REG_INT_CTRL */
+#define BMP388_INT_CTRL_LEVEL        BIT(1) /* active high */
+#define BMP388_INT_CTRL_LATCH        BIT(2) /* held until INT_STATUS is read */
+#define BMP388_INT_CTRL_FWTM_EN      BIT(3)
+#define BMP388_INT_CTRL_FFULL_EN     BIT(4)
 #define BMP388_INT_CTRL_DRDY_EN_POS  6
 #define BMP388_INT_CTRL_DRDY_EN_MASK BIT(6)
 
@@ -143,43 +177,75 @@ extern const struct bmp388_bus_io bmp388_bus_io_i2c;
 #define BMP388_CMD_FIFO_FLUSH 0xB0
 #define BMP388_CMD_SOFT_RESET 0xB6
 
+/* Mode while resumed: forced-mode builds idle in sleep between one-shots. */
+#ifdef CONFIG_NRFMODULE_BMP390_FORCED_MODE
+#define BMP390_PWR_CTRL_MODE_ACTIVE BMP388_PWR_CTRL_MODE_SLEEP
+#else
+#define BMP390_PWR_CTRL_MODE_ACTIVE BMP388_PWR_CTRL_MODE_NORMAL
+#endif
+
 /* default PWR_CTRL settings */
 #define BMP388_PWR_CTRL_ON	    \
 	(BMP388_PWR_CTRL_PRESS_EN | \
 	 BMP388_PWR_CTRL_TEMP_EN |  \
-	 BMP388_PWR_CTRL_MODE_NORMAL)
+	 BMP390_PWR_CTRL_MODE_ACTIVE)
 #define BMP388_PWR_CTRL_OFF 0
+#define BMP388_PWR_CTRL_FORCED	    \
+	(BMP388_PWR_CTRL_PRESS_EN | \
+	 BMP388_PWR_CTRL_TEMP_EN |  \
+	 BMP388_PWR_CTRL_MODE_FORCED)
+
+/* Forced-mode conversion time, datasheet 3.9.2 (maximum values, us):
+ * base + press_en * (press + 2^osr_p * per_osr) + temp_en * (temp + 2^osr_t * per_osr)
+ */
+#define BMP388_CONV_TIME_BASE_US    234
+#define BMP388_CONV_TIME_PRESS_US   392
+#define BMP388_CONV_TIME_TEMP_US    163
+#define BMP388_CONV_TIME_PER_OSR_US 2020
 
 #define BMP388_SAMPLE_BUFFER_SIZE (6)
 
-struct bmp388_cal_data {
-	uint16_t t1;
-	uint16_t t2;
-	int8_t t3;
-	int16_t p1;
-	int16_t p2;
-	int8_t p3;
-	int8_t p4;
-	uint16_t p5;
-	uint16_t p6;
-	int8_t p7;
-	int8_t p8;
-	int16_t p9;
-	int8_t p10;
-	int8_t p11;
-} __packed;
+/* Start-up time after a soft reset (datasheet t_startup). */
+#define BMP388_SOFT_RESET_TIME_MS 2
+
+/* Calibration in the form the configured compensation path consumes. */
+struct bmp390_comp {
+#ifdef CONFIG_NRFMODULE_BMP390_FLOAT_COMP
+	struct bmp390_cal_float cal;
+#else
+	struct bmp388_cal_data cal;
+#endif
+};
 
 struct bmp388_sample {
 	uint32_t press;
 	uint32_t raw_temp;
-	int64_t comp_temp;
+	/* Compensated on the first channel_get() after a fetch. */
+	bool comp_valid;
+	uint32_t comp_press; /* hundredths of Pa */
+	int32_t comp_temp;   /* millionths of a degree C */
 };
 
+/* Async (RTIO) read frame: raw counts plus the calibration they need, so
+ * compensation runs in the decoder on the consumer's side. */
+struct bmp390_encoded_data {
+	struct {
+		uint64_t timestamp;
+		uint8_t channels; /* BMP390_ENCODED_* */
+	} header;
+	struct bmp390_comp comp;
+	uint32_t raw_press;
+	uint32_t raw_temp;
+};
+
+#define BMP390_ENCODED_PRESS BIT(0)
+#define BMP390_ENCODED_TEMP  BIT(1)
+
 struct bmp388_config {
 	union bmp388_bus bus;
 	const struct bmp388_bus_io *bus_io;
 
-#ifdef CONFIG_BMP388_TRIGGER
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
 	struct gpio_dt_spec gpio_int;
 #endif
 
@@ -191,40 +257,81 @@ struct bmp388_data {
 	uint8_t osr_pressure;
 	uint8_t osr_temp;
 	uint8_t chip_id;
-	struct bmp388_cal_data cal;
-
-#if defined(CONFIG_BMP388_TRIGGER)
-	struct gpio_callback gpio_cb;
-#endif
+	struct bmp390_comp comp;
+	/* Calibration is NVM and survives a rail power-cycle, so TURN_ON reuses
+	 * it; cal_t1 (its first word) is re-read to catch a swapped part. */
+	bool cal_valid;
+	uint16_t cal_t1;
 
 	struct bmp388_sample sample;
 
-#ifdef CONFIG_BMP388_TRIGGER_OWN_THREAD
-	struct k_sem sem;
+#ifdef CONFIG_NRFMODULE_I2C_BATCH
+	/* Data read queued by bmp390_batch_add(); completes into sample. */
+	struct i2c_batch_read batch_rd;
+	uint8_t batch_raw[BMP388_SAMPLE_BUFFER_SIZE];
 #endif
 
-#ifdef CONFIG_BMP388_TRIGGER_GLOBAL_THREAD
-	struct k_work work;
+#ifdef CONFIG_NRFMODULE_BMP390_FIFO
+	/* Watermark in frames (0 = FIFO off); re-applied after a TURN_ON. */
+	uint16_t fifo_wtm_frames;
+	uint8_t fifo_buf[BMP388_FIFO_SIZE + BMP388_FIFO_TIME_FRAME_SIZE];
 #endif
 
-#if defined(CONFIG_BMP388_TRIGGER_GLOBAL_THREAD) || \
-	defined(CONFIG_BMP388_TRIGGER_DIRECT)
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
 	const struct device *dev;
-#endif
+	struct gpio_callback gpio_cb;
+	struct k_work work;
+	/* Uptime at the last interrupt, stamped in the ISR. */
+	struct k_spinlock irq_lock;
+	int64_t irq_ns;
 
-#ifdef CONFIG_BMP388_TRIGGER
 	sensor_trigger_handler_t handler_drdy;
 	const struct sensor_trigger *trig_drdy;
-#endif /* CONFIG_BMP388_TRIGGER */
+
+	/* Lock-free single-producer (work handler) single-consumer queue. */
+	bool queue_enabled;
+	atomic_t queue_head;
+	atomic_t queue_tail;
+	atomic_t queue_dropped;
+	struct k_sem queue_sem;
+	struct bmp390_sample queue[CONFIG_NRFMODULE_BMP390_QUEUE_SIZE];
+
+#ifdef CONFIG_NRFMODULE_BMP390_FORCED_MODE
+	/* Given on data-ready; ends a forced read's wait early. */
+	struct k_sem forced_sem;
+#endif
+#endif /* CONFIG_NRFMODULE_BMP390_TRIGGER */
 };
 
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
 int bmp388_trigger_mode_init(const struct device *dev);
 int bmp388_trigger_set(const struct device *dev,
 		       const struct sensor_trigger *trig,
 		       sensor_trigger_handler_t handler);
+int bmp390_int_apply(const struct device *dev);
+int bmp390_int_disable(const struct device *dev);
+#endif
 int bmp388_reg_field_update(const struct device *dev,
 			    uint8_t reg,
 			    uint8_t mask,
 			    uint8_t val);
+int bmp388_sample_fetch_helper(const struct device *dev,
+			       struct bmp388_sample *sample);
+
+#ifdef CONFIG_SENSOR_ASYNC_API
+void bmp390_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe);
+int bmp390_get_decoder(const struct device *dev,
+		       const struct sensor_decoder_api **decoder);
+uint8_t bmp390_encode_channel(enum sensor_channel chan);
+#endif
+
+/* Pressure in hundredths of Pa and temperature in millionths of a degree C,
+ * through the integer or float path (CONFIG_NRFMODULE_BMP390_FLOAT_COMP). */
+void bmp390_compensate(const struct bmp390_comp *comp, uint32_t raw_press,
+		       uint32_t raw_temp, uint32_t *press_cpa, int32_t *temp_udegc);
+
+#ifdef CONFIG_NRFMODULE_BMP390_FIFO
+int bmp390_fifo_apply(const struct device *dev);
+#endif
 
 #endif /* ZEPHYR_BMP388_H */
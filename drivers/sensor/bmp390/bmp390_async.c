@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+/*
+ * Sensor async API (submit): the blocking bus read runs on the RTIO work queue,
+ * so the submitting thread never waits on the shared I2C bus. The frame holds
+ * raw counts and a calibration copy; bmp390_decoder.c compensates them.
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/rtio/work.h>
+
+#include "bmp390.h"
+
+LOG_MODULE_DECLARE(BMP390, CONFIG_SENSOR_LOG_LEVEL);
+
+uint8_t bmp390_encode_channel(enum sensor_channel chan)
+{
+	switch (chan) {
+	case SENSOR_CHAN_PRESS:
+		return BMP390_ENCODED_PRESS;
+	case SENSOR_CHAN_DIE_TEMP:
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		return BMP390_ENCODED_TEMP;
+	case SENSOR_CHAN_ALL:
+		return BMP390_ENCODED_PRESS | BMP390_ENCODED_TEMP;
+	default:
+		return 0;
+	}
+}
+
+static void bmp390_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct device *dev = cfg->sensor;
+	const struct sensor_chan_spec *const channels = cfg->channels;
+	const size_t num_channels = cfg->count;
+	const struct bmp388_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct bmp390_encoded_data);
+	struct bmp390_encoded_data *edata;
+	struct bmp388_sample sample;
+	uint8_t *buf;
+	uint32_t buf_len;
+	uint8_t mask = 0;
+	int rc;
+
+	for (size_t i = 0; i < num_channels; i++) {
+		uint8_t bit = bmp390_encode_channel(channels[i].chan_type);
+
+		if (bit == 0 || channels[i].chan_idx != 0) {
+			LOG_ERR("Unsupported channel %d", channels[i].chan_type);
+			rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+			return;
+		}
+		mask |= bit;
+	}
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (rc != 0) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	edata = (struct bmp390_encoded_data *)buf;
+	edata->header.timestamp = k_ticks_to_ns_floor64(k_uptime_ticks());
+	edata->header.channels = mask;
+
+	rc = bmp388_sample_fetch_helper(dev, &sample);
+	if (rc != 0) {
+		LOG_ERR("Failed to fetch samples");
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	edata->comp = data->comp;
+	edata->raw_press = sample.press;
+	edata->raw_temp = sample.raw_temp;
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+void bmp390_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	ARG_UNUSED(dev);
+
+	if (req == NULL) {
+		LOG_ERR("RTIO work item allocation failed. Consider increasing "
+			"CONFIG_RTIO_WORKQ_POOL_ITEMS.");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, bmp390_submit_sync);
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+#include "bmp390_comp.h"
+
+int64_t bmp388_compensate_temp(const struct bmp388_cal_data *cal,
+			       uint32_t raw_temp)
+{
+	/* Adapted from:
+	 * https://github.com/BoschSensortec/BMP3-Sensor-API/blob/master/bmp3.c
+	 */
+
+	int64_t partial_data1;
+	int64_t partial_data2;
+	int64_t partial_data3;
+	int64_t partial_data4;
+	int64_t partial_data5;
+
+	partial_data1 = ((int64_t)raw_temp - (256 * cal->t1));
+	partial_data2 = cal->t2 * partial_data1;
+	partial_data3 = (partial_data1 * partial_data1);
+	partial_data4 = (int64_t)partial_data3 * cal->t3;
+	partial_data5 = ((int64_t)(partial_data2 * 262144) + partial_data4);
+
+	/* Linearized temperature, also the input to pressure compensation */
+	return partial_data5 / 4294967296;
+}
+
+uint64_t bmp388_compensate_press(const struct bmp388_cal_data *cal,
+				 uint32_t raw_pressure, int64_t t_lin)
+{
+	/* Adapted from:
+	 * https://github.com/BoschSensortec/BMP3-Sensor-API/blob/master/bmp3.c
+	 */
+
+	int64_t partial_data1;
+	int64_t partial_data2;
+	int64_t partial_data3;
+	int64_t partial_data4;
+	int64_t partial_data5;
+	int64_t partial_data6;
+	int64_t offset;
+	int64_t sensitivity;
+	uint64_t comp_press;
+
+	partial_data1 = t_lin * t_lin;
+	partial_data2 = partial_data1 / 64;
+	partial_data3 = (partial_data2 * t_lin) / 256;
+	partial_data4 = (cal->p8 * partial_data3) / 32;
+	partial_data5 = (cal->p7 * partial_data1) * 16;
+	partial_data6 = (cal->p6 * t_lin) * 4194304;
+	offset = (cal->p5 * 140737488355328) + partial_data4 + partial_data5 +
+		 partial_data6;
+	partial_data2 = (cal->p4 * partial_data3) / 32;
+	partial_data4 = (cal->p3 * partial_data1) * 4;
+	partial_data5 = (cal->p2 - 16384) * t_lin * 2097152;
+	sensitivity = ((cal->p1 - 16384) * 70368744177664) + partial_data2 +
+		      partial_data4 + partial_data5;
+	partial_data1 = (sensitivity / 16777216) * raw_pressure;
+	partial_data2 = cal->p10 * t_lin;
+	partial_data3 = partial_data2 + (65536 * cal->p9);
+	partial_data4 = (partial_data3 * raw_pressure) / 8192;
+	/* Dividing by 10 followed by multiplying by 10 to avoid overflow caused
+	 * (raw_pressure * partial_data4)
+	 */
+	partial_data5 = (raw_pressure * (partial_data4 / 10)) / 512;
+	partial_data5 = partial_data5 * 10;
+	partial_data6 = ((int64_t)raw_pressure * (int64_t)raw_pressure);
+	partial_data2 = (cal->p11 * partial_data6) / 65536;
+	partial_data3 = (partial_data2 * raw_pressure) / 128;
+	partial_data4 = (offset / 4) + partial_data1 + partial_data5 +
+			partial_data3;
+
+	comp_press = (((uint64_t)partial_data4 * 25) / (uint64_t)1099511627776);
+
+	/* returned value is in hundredths of Pa. */
+	return comp_press;
+}
+
+void bmp390_cal_to_float(const struct bmp388_cal_data *cal,
+			 struct bmp390_cal_float *out)
+{
+	/* Scale factors from the Bosch BMP3 API float reference
+	 * (parse_calib_data(), BMP3_FLOAT_ENABLE).
+	 */
+	out->t1 = (float)cal->t1 * 0x1p8f;
+	out->t2 = (float)cal->t2 * 0x1p-30f;
+	out->t3 = (float)cal->t3 * 0x1p-48f;
+	out->p1 = (float)(cal->p1 - 16384) * 0x1p-20f;
+	out->p2 = (float)(cal->p2 - 16384) * 0x1p-29f;
+	out->p3 = (float)cal->p3 * 0x1p-32f;
+	out->p4 = (float)cal->p4 * 0x1p-37f;
+	out->p5 = (float)cal->p5 * 0x1p3f;
+	out->p6 = (float)cal->p6 * 0x1p-6f;
+	out->p7 = (float)cal->p7 * 0x1p-8f;
+	out->p8 = (float)cal->p8 * 0x1p-15f;
+	out->p9 = (float)cal->p9 * 0x1p-48f;
+	out->p10 = (float)cal->p10 * 0x1p-48f;
+	out->p11 = (float)cal->p11 * 0x1p-65f;
+}
+
+float bmp390_compensate_temp_f(const struct bmp390_cal_float *cal,
+			       uint32_t raw_temp)
+{
+	/* Exact: raw_temp and t1 * 2^8 both fit the 24-bit mantissa. */
+	const float d = (float)raw_temp - cal->t1;
+
+	return d * (cal->t2 + d * cal->t3);
+}
+
+float bmp390_compensate_press_f(const struct bmp390_cal_float *cal,
+				uint32_t raw_pressure, float temp)
+{
+	const float p = (float)raw_pressure;
+	const float offset = cal->p5 + temp * (cal->p6 + temp * (cal->p7 + temp * cal->p8));
+	const float sensitivity = cal->p1 + temp * (cal->p2 + temp * (cal->p3 + temp * cal->p4));
+	const float nonlin = (cal->p9 + temp * cal->p10) + p * cal->p11;
+
+	/* offset + p * sensitivity + p^2 * (p9 + p10 * t) + p^3 * p11 */
+	return offset + p * (sensitivity + p * nonlin);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+/*
+ * BMP3xx compensation, free of device and bus code so it can be unit tested
+ * (tests/bmp390_comp). Two paths:
+ *  - integer: Bosch BMP3 API 64-bit reference, used by default;
+ *  - float: the calibration is scaled once into float coefficients (Bosch
+ *    float reference), after which a sample costs a few multiply-adds.
+ *    Meant for parts with a single-precision FPU.
+ */
+
+#ifndef NRFMODULE_BMP390_COMP_H
+#define NRFMODULE_BMP390_COMP_H
+
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+
+/* Calibration registers as read from BMP388_REG_CALIB0 (little endian). */
+struct bmp388_cal_data {
+	uint16_t t1;
+	uint16_t t2;
+	int8_t t3;
+	int16_t p1;
+	int16_t p2;
+	int8_t p3;
+	int8_t p4;
+	uint16_t p5;
+	uint16_t p6;
+	int8_t p7;
+	int8_t p8;
+	int16_t p9;
+	int8_t p10;
+	int8_t p11;
+} __packed;
+
+/* Calibration pre-scaled for the float path (bmp390_cal_to_float()). */
+struct bmp390_cal_float {
+	float t1;
+	float t2;
+	float t3;
+	float p1;
+	float p2;
+	float p3;
+	float p4;
+	float p5;
+	float p6;
+	float p7;
+	float p8;
+	float p9;
+	float p10;
+	float p11;
+};
+
+/* Linearized temperature t_lin, in 1/65536 degrees C. */
+int64_t bmp388_compensate_temp(const struct bmp388_cal_data *cal,
+			       uint32_t raw_temp);
+/* Pressure in hundredths of Pa; t_lin from bmp388_compensate_temp(). */
+uint64_t bmp388_compensate_press(const struct bmp388_cal_data *cal,
+				 uint32_t raw_pressure, int64_t t_lin);
+
+void bmp390_cal_to_float(const struct bmp388_cal_data *cal,
+			 struct bmp390_cal_float *out);
+/* Temperature in degrees C. */
+float bmp390_compensate_temp_f(const struct bmp390_cal_float *cal,
+			       uint32_t raw_temp);
+/* Pressure in Pa; temp from bmp390_compensate_temp_f(). */
+float bmp390_compensate_press_f(const struct bmp390_cal_float *cal,
+				uint32_t raw_pressure, float temp);
+
+#endif /* NRFMODULE_BMP390_COMP_H */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+/*
+ * Sensor decoder for bmp390_encoded_data frames: compensation runs on the
+ * consumer's side, output as q31 (pressure in kPa, temperature in degrees C).
+ */
+
+#include "bmp390.h"
+
+#define DT_DRV_COMPAT bosch_bmp390
+
+/* 2^7 = 128: covers 30..125 kPa and -40..85 C with ~60 ppb resolution. */
+#define BMP390_Q31_SHIFT 7
+
+static int64_t bmp390_to_q31(int64_t value, int64_t scale)
+{
+	/* value / scale * 2^(31 - shift), without shifting a negative value */
+	return (value * (INT64_C(1) << (31 - BMP390_Q31_SHIFT))) / scale;
+}
+
+static int bmp390_decoder_get_frame_count(const uint8_t *buffer,
+					  struct sensor_chan_spec chan_spec,
+					  uint16_t *frame_count)
+{
+	const struct bmp390_encoded_data *edata =
+		(const struct bmp390_encoded_data *)buffer;
+	uint8_t mask = bmp390_encode_channel(chan_spec.chan_type);
+
+	if (chan_spec.chan_idx != 0 || mask == 0) {
+		return -ENOTSUP;
+	}
+	if ((edata->header.channels & mask) != mask) {
+		return -ENODATA;
+	}
+
+	*frame_count = 1;
+	return 0;
+}
+
+static int bmp390_decoder_get_size_info(struct sensor_chan_spec chan_spec,
+					size_t *base_size, size_t *frame_size)
+{
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_PRESS:
+	case SENSOR_CHAN_DIE_TEMP:
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		*base_size = sizeof(struct sensor_q31_data);
+		*frame_size = sizeof(struct sensor_q31_sample_data);
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static int bmp390_decoder_decode(const uint8_t *buffer,
+				 struct sensor_chan_spec chan_spec,
+				 uint32_t *fit, uint16_t max_count,
+				 void *data_out)
+{
+	const struct bmp390_encoded_data *edata =
+		(const struct bmp390_encoded_data *)buffer;
+	struct sensor_q31_data *out = data_out;
+	uint8_t mask = bmp390_encode_channel(chan_spec.chan_type);
+	uint32_t press_cpa;
+	int32_t temp_udegc;
+
+	if (*fit != 0) {
+		return 0;
+	}
+	if (max_count == 0 || chan_spec.chan_idx != 0 || mask == 0 ||
+	    mask == (BMP390_ENCODED_PRESS | BMP390_ENCODED_TEMP)) {
+		return -EINVAL;
+	}
+	if ((edata->header.channels & mask) != mask) {
+		return -ENODATA;
+	}
+
+	out->header.base_timestamp_ns = edata->header.timestamp;
+	out->header.reading_count = 1;
+	out->shift = BMP390_Q31_SHIFT;
+	out->readings[0].timestamp_delta = 0;
+
+	/* Pressure compensation needs the temperature either way. */
+	bmp390_compensate(&edata->comp, edata->raw_press, edata->raw_temp,
+			  &press_cpa, &temp_udegc);
+
+	if (mask == BMP390_ENCODED_PRESS) {
+		/* hundredths of Pa -> kPa */
+		out->readings[0].pressure = (q31_t)bmp390_to_q31(press_cpa, 100000);
+	} else {
+		out->readings[0].temperature = (q31_t)bmp390_to_q31(temp_udegc, 1000000);
+	}
+
+	*fit = 1;
+	return 1;
+}
+
+SENSOR_DECODER_API_DT_DEFINE() = {
+	.get_frame_count = bmp390_decoder_get_frame_count,
+	.get_size_info = bmp390_decoder_get_size_info,
+	.decode = bmp390_decoder_decode,
+};
+
+int bmp390_get_decoder(const struct device *dev,
+		       const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
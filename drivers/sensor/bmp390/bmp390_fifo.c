@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+/*
+ * Hardware FIFO batching for the BMP390: the chip buffers pressure,
+ * temperature and sensortime frames at its ODR, and bmp390_fifo_read() drains
+ * them in one burst read.
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/pm/device.h>
+
+#include <drivers/sensor/bmp390_extended.h>
+
+#include "bmp390.h"
+
+LOG_MODULE_DECLARE(BMP390, CONFIG_SENSOR_LOG_LEVEL);
+
+BUILD_ASSERT(BMP390_FIFO_MAX_FRAMES * BMP388_FIFO_FRAME_SIZE <= BMP388_FIFO_WTM_MAX,
+	     "watermark register is 9 bits");
+BUILD_ASSERT(BMP390_FIFO_TIME_NONE == BMP390_SENSOR_TIME_INVALID,
+	     "parser and API agree on a missing sensortime");
+
+struct bmp390_fifo_out {
+	const struct bmp390_comp *comp;
+	struct bmp390_frame *frames;
+};
+
+static void bmp390_fifo_frame(void *ctx, size_t idx, uint32_t raw_press,
+			      uint32_t raw_temp)
+{
+	struct bmp390_fifo_out *out = ctx;
+	int32_t temp_udegc;
+
+	bmp390_compensate(out->comp, raw_press, raw_temp, &out->frames[idx].press_cpa,
+			  &temp_udegc);
+	out->frames[idx].temp_mdegc = temp_udegc / 1000;
+}
+
+static inline int bmp390_fifo_reg_write(const struct device *dev, uint8_t reg,
+					uint8_t val)
+{
+	const struct bmp388_config *cfg = dev->config;
+
+	return cfg->bus_io->write(&cfg->bus, reg, val);
+}
+
+static inline int bmp390_fifo_reg_read(const struct device *dev, uint8_t start,
+				       uint8_t *buf, int size)
+{
+	const struct bmp388_config *cfg = dev->config;
+
+	return cfg->bus_io->read(&cfg->bus, start, buf, size);
+}
+
+int bmp390_fifo_apply(const struct device *dev)
+{
+	struct bmp388_data *data = dev->data;
+	uint16_t wtm = data->fifo_wtm_frames * BMP388_FIFO_FRAME_SIZE;
+
+	if (data->fifo_wtm_frames == 0) {
+		if (bmp390_fifo_reg_write(dev, BMP388_REG_FIFO_CONFIG1, 0) < 0) {
+			return -EIO;
+		}
+	} else {
+		if (bmp390_fifo_reg_write(dev, BMP388_REG_FIFO_WTM0, wtm & 0xFF) < 0 ||
+		    bmp390_fifo_reg_write(dev, BMP388_REG_FIFO_WTM1, (wtm >> 8) & 0x01) < 0 ||
+		    bmp390_fifo_reg_write(dev, BMP388_REG_FIFO_CONFIG2,
+					  BMP388_FIFO_CONFIG2_DATA_SELECT_FILTERED) < 0 ||
+		    bmp390_fifo_reg_write(dev, BMP388_REG_FIFO_CONFIG1,
+					  BMP388_FIFO_CONFIG1_MODE |
+					  BMP388_FIFO_CONFIG1_TIME_EN |
+					  BMP388_FIFO_CONFIG1_PRESS_EN |
+					  BMP388_FIFO_CONFIG1_TEMP_EN) < 0) {
+			return -EIO;
+		}
+	}
+
+	if (bmp390_fifo_reg_write(dev, BMP388_REG_CMD, BMP388_CMD_FIFO_FLUSH) < 0) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+int bmp390_fifo_start(const struct device *dev, uint16_t wtm_frames)
+{
+	struct bmp388_data *data = dev->data;
+
+	if (wtm_frames == 0 || wtm_frames > BMP390_FIFO_MAX_FRAMES) {
+		return -EINVAL;
+	}
+
+	data->fifo_wtm_frames = wtm_frames;
+	if (bmp390_fifo_apply(dev) < 0) {
+		LOG_ERR("Failed to configure FIFO.");
+		data->fifo_wtm_frames = 0;
+		return -EIO;
+	}
+
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
+	/* Switch a running sample queue from data-ready to watermark. */
+	return bmp390_int_apply(dev);
+#else
+	return 0;
+#endif
+}
+
+int bmp390_fifo_stop(const struct device *dev)
+{
+	struct bmp388_data *data = dev->data;
+
+	data->fifo_wtm_frames = 0;
+
+	if (bmp390_fifo_apply(dev) < 0) {
+		return -EIO;
+	}
+
+#ifdef CONFIG_NRFMODULE_BMP390_TRIGGER
+	return bmp390_int_apply(dev);
+#else
+	return 0;
+#endif
+}
+
+int bmp390_fifo_read(const struct device *dev, struct bmp390_frame *frames,
+		     size_t max_frames)
+{
+	struct bmp388_data *data = dev->data;
+	struct bmp390_fifo_out out = { .comp = &data->comp, .frames = frames };
+	uint32_t sensor_time;
+	uint8_t raw[2];
+	size_t len;
+	size_t n;
+	int ret;
+
+	if (data->fifo_wtm_frames == 0) {
+		return -EACCES;
+	}
+	if (max_frames == 0) {
+		return 0;
+	}
+
+	pm_device_busy_set(dev);
+
+	ret = bmp390_fifo_reg_read(dev, BMP388_REG_FIFO_LENGTH0, raw, sizeof(raw));
+	if (ret < 0) {
+		goto error;
+	}
+
+	len = sys_get_le16(raw) & BMP388_FIFO_WTM_MAX;
+	if (len == 0) {
+		goto error;
+	}
+
+	if (len > max_frames * BMP388_FIFO_FRAME_SIZE) {
+		/* Leave the newer frames queued; no sensortime this time. */
+		len = max_frames * BMP388_FIFO_FRAME_SIZE;
+	} else {
+		/* Reading past the fill level returns the sensortime frame. */
+		len += BMP388_FIFO_TIME_FRAME_SIZE;
+	}
+
+	ret = bmp390_fifo_reg_read(dev, BMP388_REG_FIFO_DATA, data->fifo_buf, len);
+	if (ret < 0) {
+		goto error;
+	}
+
+	n = bmp390_fifo_parse(data->fifo_buf, len, max_frames, bmp390_fifo_frame, &out,
+			      &sensor_time);
+
+	/* The sensortime frame stamps the newest frame; earlier frames are one
+	 * ODR period apart. */
+	const uint32_t period = BMP388_SENSORTIME_TICKS_PER_ODR0 << data->odr;
+
+	for (size_t i = 0; i < n; i++) {
+		frames[i].sensor_time = bmp390_fifo_frame_time(sensor_time, n, i, period);
+	}
+
+	ret = (int)n;
+
+error:
+	pm_device_busy_clear(dev);
+	return ret;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+#include "bmp390_fifo_parse.h"
+
+#include <zephyr/sys/byteorder.h>
+
+size_t bmp390_fifo_parse(const uint8_t *buf, size_t len, size_t max_frames,
+			 bmp390_fifo_frame_cb cb, void *ctx, uint32_t *sensor_time)
+{
+	size_t pos = 0;
+	size_t n = 0;
+
+	*sensor_time = BMP390_FIFO_TIME_NONE;
+
+	while (pos < len) {
+		uint8_t header = buf[pos++];
+
+		switch (header) {
+		case BMP388_FIFO_FRAME_PRESS_TEMP:
+			if (pos + 6 > len || n == max_frames) {
+				pos = len;
+				break;
+			}
+
+			/* Frame order is temperature, then pressure. */
+			cb(ctx, n, sys_get_le24(&buf[pos + 3]), sys_get_le24(&buf[pos]));
+			n++;
+			pos += 6;
+			break;
+		case BMP388_FIFO_FRAME_TEMP:
+		case BMP388_FIFO_FRAME_PRESS:
+			/* Single-channel frames are not enabled; skip them. */
+			pos += 3;
+			break;
+		case BMP388_FIFO_FRAME_TIME:
+			if (pos + 3 <= len) {
+				*sensor_time = sys_get_le24(&buf[pos]);
+			}
+			pos += 3;
+			break;
+		case BMP388_FIFO_FRAME_CONFIG_ERR:
+		case BMP388_FIFO_FRAME_CONFIG_CHG:
+			pos += 1;
+			break;
+		case BMP388_FIFO_FRAME_EMPTY:
+		default:
+			pos = len;
+			break;
+		}
+	}
+
+	return n;
+}
+
+uint32_t bmp390_fifo_frame_time(uint32_t sensor_time, size_t n, size_t idx,
+				uint32_t period)
+{
+	if (sensor_time == BMP390_FIFO_TIME_NONE) {
+		return BMP390_FIFO_TIME_NONE;
+	}
+
+	return (sensor_time - (uint32_t)(n - 1 - idx) * period) & BMP388_SENSORTIME_MASK;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+/*
+ * BMP3xx FIFO frame parsing, free of device and bus code so it can be unit
+ * tested (tests/bmp390_fifo) on canned FIFO_DATA bursts. bmp390_fifo.c does
+ * the burst read and compensation around it.
+ */
+
+#ifndef NRFMODULE_BMP390_FIFO_PARSE_H
+#define NRFMODULE_BMP390_FIFO_PARSE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* FIFO frame headers (the data bytes that follow are in parentheses) */
+#define BMP388_FIFO_FRAME_PRESS_TEMP 0x94 /* (temp[3], press[3]) */
+#define BMP388_FIFO_FRAME_TEMP       0x90 /* (temp[3]) */
+#define BMP388_FIFO_FRAME_PRESS      0x84 /* (press[3]) */
+#define BMP388_FIFO_FRAME_TIME       0xA0 /* (sensortime[3]) */
+#define BMP388_FIFO_FRAME_EMPTY      0x80
+#define BMP388_FIFO_FRAME_CONFIG_ERR 0x44 /* (1 byte) */
+#define BMP388_FIFO_FRAME_CONFIG_CHG 0x48 /* (1 byte) */
+
+#define BMP388_FIFO_FRAME_SIZE     7 /* header + temp + press */
+#define BMP388_FIFO_TIME_FRAME_SIZE 4
+
+/* sensortime ticks at 25.6 kHz; ODR setting n samples every 5 ms << n */
+#define BMP388_SENSORTIME_TICKS_PER_ODR0 128
+/* sensortime is a 24-bit counter. */
+#define BMP388_SENSORTIME_MASK 0xFFFFFF
+/* No sensortime frame in the burst; equals BMP390_SENSOR_TIME_INVALID. */
+#define BMP390_FIFO_TIME_NONE UINT32_MAX
+
+/* Called for each pressure + temperature frame, oldest first, idx from 0. */
+typedef void (*bmp390_fifo_frame_cb)(void *ctx, size_t idx, uint32_t raw_press,
+				     uint32_t raw_temp);
+
+/* Walk @p len bytes of FIFO_DATA. Up to @p max_frames pressure + temperature
+ * frames go to @p cb; single-channel, config-change and config-error frames
+ * are skipped; an empty or truncated frame ends the walk. *sensor_time is set
+ * from a complete sensortime frame, else BMP390_FIFO_TIME_NONE. Returns the
+ * number of frames passed to @p cb.
+ */
+size_t bmp390_fifo_parse(const uint8_t *buf, size_t len, size_t max_frames,
+			 bmp390_fifo_frame_cb cb, void *ctx, uint32_t *sensor_time);
+
+/* Sensortime of frame @p idx of @p n: the newest carries @p sensor_time and
+ * each older one is @p period ticks earlier, modulo the 24-bit counter.
+ * BMP390_FIFO_TIME_NONE stays NONE.
+ */
+uint32_t bmp390_fifo_frame_time(uint32_t sensor_time, size_t n, size_t idx,
+				uint32_t period);
+
+#endif /* NRFMODULE_BMP390_FIFO_PARSE_H */
@@ -31,9 +31,16 @@ static int bmp388_reg_write_i2c(const union bmp388_bus *bus,
 	return i2c_reg_write_byte_dt(&bus->i2c, reg, val);
 }
 
+static int bmp388_reg_write_pairs_i2c(const union bmp388_bus *bus,
+				      const uint8_t *pairs, int size)
+{
+	return i2c_write_dt(&bus->i2c, pairs, size);
+}
+
 const struct bmp388_bus_io bmp388_bus_io_i2c = {
 	.check = bmp388_bus_check_i2c,
 	.read = bmp388_reg_read_i2c,
 	.write = bmp388_reg_write_i2c,
+	.write_pairs = bmp388_reg_write_pairs_i2c,
 };
 #endif /* BMP3XX_USE_I2C_BUS */
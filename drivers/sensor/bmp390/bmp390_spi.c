@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+/*
+ * Bus-specific functionality for BMP388s accessed via SPI.
+ *
+ * Reads are one burst per call: the register address with bit 7 set, one
+ * dummy byte (datasheet 5.3.2), then the data, so a full FIFO drain is a
+ * single transaction.
+ */
+
+#include "bmp390.h"
+
+#ifdef BMP3XX_USE_SPI_BUS
+
+#define BMP388_SPI_READ_BIT BIT(7)
+
+static int bmp388_bus_check_spi(const union bmp388_bus *bus)
+{
+	return spi_is_ready_dt(&bus->spi) ? 0 : -ENODEV;
+}
+
+static int bmp388_reg_read_spi(const union bmp388_bus *bus,
+			       uint8_t start, uint8_t *buf, int size)
+{
+	uint8_t addr = start | BMP388_SPI_READ_BIT;
+	const struct spi_buf tx_buf = {
+		.buf = &addr,
+		.len = 1,
+	};
+	const struct spi_buf_set tx = {
+		.buffers = &tx_buf,
+		.count = 1,
+	};
+	const struct spi_buf rx_buf[] = {
+		/* clocked out during the address and dummy bytes */
+		{ .buf = NULL, .len = 2 },
+		{ .buf = buf, .len = size },
+	};
+	const struct spi_buf_set rx = {
+		.buffers = rx_buf,
+		.count = ARRAY_SIZE(rx_buf),
+	};
+
+	return spi_transceive_dt(&bus->spi, &tx, &rx);
+}
+
+static int bmp388_reg_write_spi(const union bmp388_bus *bus,
+				uint8_t reg, uint8_t val)
+{
+	uint8_t cmd[] = { reg & ~BMP388_SPI_READ_BIT, val };
+	const struct spi_buf tx_buf = {
+		.buf = cmd,
+		.len = sizeof(cmd),
+	};
+	const struct spi_buf_set tx = {
+		.buffers = &tx_buf,
+		.count = 1,
+	};
+
+	return spi_write_dt(&bus->spi, &tx);
+}
+
+static int bmp388_reg_write_pairs_spi(const union bmp388_bus *bus,
+				      const uint8_t *pairs, int size)
+{
+	/* Register addresses are all below 0x80, i.e. already write commands. */
+	const struct spi_buf tx_buf = {
+		.buf = (uint8_t *)pairs,
+		.len = size,
+	};
+	const struct spi_buf_set tx = {
+		.buffers = &tx_buf,
+		.count = 1,
+	};
+
+	return spi_write_dt(&bus->spi, &tx);
+}
+
+const struct bmp388_bus_io bmp388_bus_io_spi = {
+	.check = bmp388_bus_check_spi,
+	.read = bmp388_reg_read_spi,
+	.write = bmp388_reg_write_spi,
+	.write_pairs = bmp388_reg_write_pairs_spi,
+};
+#endif /* BMP3XX_USE_SPI_BUS */
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * nrfmodule-lint: vendored - extension of the vendored Zephyr bmp388 driver; follows its style.
+ */
+
+/*
+ * INT pin (int-gpios): the ISR only stamps the time and queues work; the work
+ * handler reads INT_STATUS, calls the data-ready trigger handler, and pushes
+ * the sample (or a FIFO watermark's worth of frames) into the sample queue.
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/pm/device.h>
+
+#include "bmp390.h"
+
+LOG_MODULE_DECLARE(BMP390, CONFIG_SENSOR_LOG_LEVEL);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NRFMODULE_BMP390_QUEUE_SIZE),
+	     "sample queue size must be a power of two");
+
+#define BMP390_QUEUE_MASK (CONFIG_NRFMODULE_BMP390_QUEUE_SIZE - 1)
+
+/* Frames drained per bmp390_fifo_read() call, bounded by work queue stack. */
+#define BMP390_DRAIN_CHUNK 8
+
+static inline int bmp390_trig_reg_read(const struct device *dev, uint8_t start,
+				       uint8_t *buf, int size)
+{
+	const struct bmp388_config *cfg = dev->config;
+
+	return cfg->bus_io->read(&cfg->bus, start, buf, size);
+}
+
+static inline int bmp390_trig_reg_write(const struct device *dev, uint8_t reg,
+					uint8_t val)
+{
+	const struct bmp388_config *cfg = dev->config;
+
+	return cfg->bus_io->write(&cfg->bus, reg, val);
+}
+
+/* Producer side; only the work handler calls it. */
+static void bmp390_queue_put(struct bmp388_data *data,
+			     const struct bmp390_sample *sample)
+{
+	uint32_t head = (uint32_t)atomic_get(&data->queue_head);
+	uint32_t tail = (uint32_t)atomic_get(&data->queue_tail);
+
+	if (head - tail >= CONFIG_NRFMODULE_BMP390_QUEUE_SIZE) {
+		atomic_inc(&data->queue_dropped);
+		return;
+	}
+
+	data->queue[head & BMP390_QUEUE_MASK] = *sample;
+	/* Publish the slot; atomic_set() orders the copy before it. */
+	atomic_set(&data->queue_head, (atomic_val_t)(head + 1));
+	k_sem_give(&data->queue_sem);
+}
+
+static void bmp390_queue_drdy(const struct device *dev, int64_t irq_ns)
+{
+	struct bmp388_data *data = dev->data;
+	uint8_t raw[BMP388_SAMPLE_BUFFER_SIZE];
+	struct bmp390_sample sample;
+	int32_t temp_udegc;
+
+	if (bmp390_trig_reg_read(dev, BMP388_REG_DATA0, raw, sizeof(raw)) < 0) {
+		LOG_ERR("Failed to read sample.");
+		return;
+	}
+
+	bmp390_compensate(&data->comp, sys_get_le24(&raw[0]), sys_get_le24(&raw[3]),
+			  &sample.press_cpa, &temp_udegc);
+	sample.temp_mdegc = temp_udegc / 1000;
+	sample.timestamp_ns = irq_ns;
+
+	bmp390_queue_put(data, &sample);
+}
+
+#ifdef CONFIG_NRFMODULE_BMP390_FIFO
+static void bmp390_queue_fifo(const struct device *dev, int64_t irq_ns)
+{
+	struct bmp388_data *data = dev->data;
+	struct bmp390_frame frames[BMP390_DRAIN_CHUNK];
+	/* sensortime ticks are 1 / 25.6 kHz = 78125 / 2 ns */
+	const int64_t period_ns =
+		((int64_t)(BMP388_SENSORTIME_TICKS_PER_ODR0 << data->odr) * 78125) / 2;
+	/* Index of the frame that raised the watermark. */
+	const int32_t anchor = data->fifo_wtm_frames - 1;
+	int32_t k = 0;
+	int n;
+
+	do {
+		n = bmp390_fifo_read(dev, frames, ARRAY_SIZE(frames));
+
+		for (int i = 0; i < n; i++, k++) {
+			struct bmp390_sample sample = {
+				.press_cpa = frames[i].press_cpa,
+				.temp_mdegc = frames[i].temp_mdegc,
+				.timestamp_ns = irq_ns + (k - anchor) * period_ns,
+			};
+
+			bmp390_queue_put(data, &sample);
+		}
+	} while (n == ARRAY_SIZE(frames) && k < BMP390_FIFO_MAX_FRAMES);
+
+	if (n < 0) {
+		LOG_ERR("Failed to drain FIFO.");
+	}
+}
+#endif
+
+static void bmp388_work_handler(struct k_work *work)
+{
+	struct bmp388_data *data = CONTAINER_OF(work, struct bmp388_data, work);
+	const struct device *dev = data->dev;
+	k_spinlock_key_t key;
+	int64_t irq_ns;
+	uint8_t status;
+
+	key = k_spin_lock(&data->irq_lock);
+	irq_ns = data->irq_ns;
+	k_spin_unlock(&data->irq_lock, key);
+
+	/* Reading INT_STATUS clears it and releases the latched pin. */
+	if (bmp390_trig_reg_read(dev, BMP388_REG_INT_STATUS, &status, 1) < 0) {
+		LOG_ERR("Failed to read interrupt status.");
+		return;
+	}
+
+	if (status & BMP388_INT_STATUS_DRDY) {
+#ifdef CONFIG_NRFMODULE_BMP390_FORCED_MODE
+		k_sem_give(&data->forced_sem);
+#endif
+		if (data->handler_drdy != NULL) {
+			data->handler_drdy(dev, data->trig_drdy);
+		}
+		if (data->queue_enabled) {
+			bmp390_queue_drdy(dev, irq_ns);
+		}
+	}
+
+#ifdef CONFIG_NRFMODULE_BMP390_FIFO
+	if ((status & BMP388_INT_STATUS_FWM) && data->queue_enabled &&
+	    data->fifo_wtm_frames != 0) {
+		bmp390_queue_fifo(dev, irq_ns);
+	}
+#endif
+}
+
+static void bmp388_gpio_callback(const struct device *port,
+				 struct gpio_callback *cb,
+				 uint32_t pin)
+{
+	struct bmp388_data *data = CONTAINER_OF(cb, struct bmp388_data, gpio_cb);
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(port);
+	ARG_UNUSED(pin);
+
+	key = k_spin_lock(&data->irq_lock);
+	data->irq_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+	k_spin_unlock(&data->irq_lock, key);
+
+	k_work_submit(&data->work);
+}
+
+int bmp390_int_apply(const struct device *dev)
+{
+	const struct bmp388_config *cfg = dev->config;
+	struct bmp388_data *data = dev->data;
+	uint8_t int_ctrl = BMP388_INT_CTRL_LATCH;
+	bool fifo = false;
+	int ret;
+
+	if (cfg->gpio_int.port == NULL) {
+		return 0;
+	}
+
+	/* Rail gated: chip init re-applies this after TURN_ON. */
+	if (!pm_device_is_powered(dev)) {
+		return 0;
+	}
+
+	/* Drive the pin with the polarity the devicetree declares. */
+	if (!(cfg->gpio_int.dt_flags & GPIO_ACTIVE_LOW)) {
+		int_ctrl |= BMP388_INT_CTRL_LEVEL;
+	}
+
+#ifdef CONFIG_NRFMODULE_BMP390_FIFO
+	fifo = data->fifo_wtm_frames != 0;
+#endif
+
+	if (data->queue_enabled && fifo) {
+		int_ctrl |= BMP388_INT_CTRL_FWTM_EN;
+	}
+	/* Forced mode: the chip converts only on request, so data-ready costs
+	 * one interrupt per fetch and ends its wait.
+	 */
+	if (IS_ENABLED(CONFIG_NRFMODULE_BMP390_FORCED_MODE) ||
+	    data->handler_drdy != NULL || (data->queue_enabled && !fifo)) {
+		int_ctrl |= BMP388_INT_CTRL_DRDY_EN_MASK;
+	}
+
+	if (!(int_ctrl & (BMP388_INT_CTRL_FWTM_EN | BMP388_INT_CTRL_DRDY_EN_MASK))) {
+		ret = gpio_pin_interrupt_configure_dt(&cfg->gpio_int, GPIO_INT_DISABLE);
+		if (ret < 0) {
+			return ret;
+		}
+		return (bmp390_trig_reg_write(dev, BMP388_REG_INT_CTRL, int_ctrl) < 0) ? -EIO : 0;
+	}
+
+	/* Arm the edge detector before the chip can raise the pin. */
+	ret = gpio_pin_interrupt_configure_dt(&cfg->gpio_int, GPIO_INT_EDGE_TO_ACTIVE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (bmp390_trig_reg_write(dev, BMP388_REG_INT_CTRL, int_ctrl) < 0) {
+		return -EIO;
+	}
+
+	/* Latched before the edge detector was armed (or by an earlier
+	 * configuration): no edge will come, so take it from here. */
+	if (gpio_pin_get_dt(&cfg->gpio_int) > 0) {
+		bmp388_gpio_callback(cfg->gpio_int.port, &data->gpio_cb,
+				     BIT(cfg->gpio_int.pin));
+	}
+
+	return 0;
+}
+
+int bmp390_int_disable(const struct device *dev)
+{
+	const struct bmp388_config *cfg = dev->config;
+
+	if (cfg->gpio_int.port == NULL) {
+		return 0;
+	}
+
+	return gpio_pin_interrupt_configure_dt(&cfg->gpio_int, GPIO_INT_DISABLE);
+}
+
+int bmp388_trigger_set(const struct device *dev,
+		       const struct sensor_trigger *trig,
+		       sensor_trigger_handler_t handler)
+{
+	const struct bmp388_config *cfg = dev->config;
+	struct bmp388_data *data = dev->data;
+
+	if (trig->type != SENSOR_TRIG_DATA_READY) {
+		LOG_ERR("Unsupported sensor trigger");
+		return -ENOTSUP;
+	}
+	if (cfg->gpio_int.port == NULL) {
+		return -ENOTSUP;
+	}
+
+	data->handler_drdy = handler;
+	data->trig_drdy = trig;
+
+	return bmp390_int_apply(dev);
+}
+
+int bmp388_trigger_mode_init(const struct device *dev)
+{
+	struct bmp388_data *data = dev->data;
+	const struct bmp388_config *cfg = dev->config;
+
+	data->dev = dev;
+	k_work_init(&data->work, bmp388_work_handler);
+	k_sem_init(&data->queue_sem, 0, K_SEM_MAX_LIMIT);
+#ifdef CONFIG_NRFMODULE_BMP390_FORCED_MODE
+	k_sem_init(&data->forced_sem, 0, 1);
+#endif
+
+	/* No int-gpios on this instance: polling only. */
+	if (cfg->gpio_int.port == NULL) {
+		return 0;
+	}
+
+	if (!gpio_is_ready_dt(&cfg->gpio_int)) {
+		LOG_ERR("INT device is not ready");
+		return -ENODEV;
+	}
+
+	if (gpio_pin_configure_dt(&cfg->gpio_int, GPIO_INPUT) < 0) {
+		return -EIO;
+	}
+
+	gpio_init_callback(&data->gpio_cb, bmp388_gpio_callback,
+			   BIT(cfg->gpio_int.pin));
+
+	return gpio_add_callback(cfg->gpio_int.port, &data->gpio_cb);
+}
+
+int bmp390_queue_enable(const struct device *dev, bool enable)
+{
+	const struct bmp388_config *cfg = dev->config;
+	struct bmp388_data *data = dev->data;
+
+	/* Forced mode converts only inside sample_fetch(): no data-ready
+	 * interrupt would ever feed the queue.
+	 */
+	if (IS_ENABLED(CONFIG_NRFMODULE_BMP390_FORCED_MODE) || cfg->gpio_int.port == NULL) {
+		return -ENOTSUP;
+	}
+
+	data->queue_enabled = enable;
+
+	return (bmp390_int_apply(dev) < 0) ? -EIO : 0;
+}
+
+int bmp390_queue_get(const struct device *dev, struct bmp390_sample *sample,
+		     k_timeout_t timeout)
+{
+	struct bmp388_data *data = dev->data;
+	uint32_t tail;
+
+	/* One count per published slot. */
+	if (k_sem_take(&data->queue_sem, timeout) != 0) {
+		return -EAGAIN;
+	}
+
+	tail = (uint32_t)atomic_get(&data->queue_tail);
+	*sample = data->queue[tail & BMP390_QUEUE_MASK];
+	atomic_set(&data->queue_tail, (atomic_val_t)(tail + 1));
+
+	return 0;
+}
+
+uint32_t bmp390_queue_dropped(const struct device *dev)
+{
+	struct bmp388_data *data = dev->data;
+
+	return (uint32_t)atomic_get(&data->queue_dropped);
+}
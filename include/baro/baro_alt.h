@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_BARO_ALT_H_
+#define NRFMODULE_BARO_ALT_H_
+
+/**
+ * @file baro_alt.h
+ * @brief Pressure altitude and vertical speed (pure, fixed-point, no hardware).
+ *
+ * baro_alt_mm() replaces the per-sample powf() of the ISA barometric formula
+ * with a 257-entry table of 44330.77 * (1 - (p / p0)^0.190263) m, linearly
+ * interpolated on a Q24 pressure ratio: within 0.12 m of the formula from
+ * 30 to 110 kPa. The ratio is clamped to 0.25..1.25 (about -1.9..10.3 km).
+ *
+ * baro_alt_filter is an alpha-beta tracker of altitude and vertical speed.
+ * Set the gains directly for a fixed complementary filter, or derive the
+ * steady-state Kalman gains from the noise levels with
+ * baro_alt_filter_gains(). An optional vertical acceleration (gravity
+ * removed, up positive) drives the prediction, so the accelerometer supplies
+ * the fast part and the barometer the drift-free part.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ISA sea-level pressure, 1013.25 hPa, in hundredths of Pa. */
+#define BARO_ALT_P0_STD_CPA (10132500U)
+
+/** Gains, Q16 (65536 = 1.0). */
+struct baro_alt_filter_cfg {
+	uint32_t alpha; /**< Altitude correction, 0..65536 (1.0 = trust the baro). */
+	uint32_t beta;  /**< Vertical-speed correction, 0..131072. */
+};
+
+/** Filter state; treat as opaque. */
+struct baro_alt_filter {
+	struct baro_alt_filter_cfg cfg;
+	int64_t alt_um;   /**< Altitude estimate, micrometres. */
+	int64_t vs_um_s;  /**< Vertical speed estimate, micrometres per second. */
+	bool primed;      /**< First sample seen. */
+};
+
+/**
+ * Altitude above the @p p0_cpa pressure level.
+ *
+ * @param press_cpa Pressure in hundredths of Pa (bmp390 comp_press units).
+ * @param p0_cpa    Reference pressure; BARO_ALT_P0_STD_CPA gives pressure
+ *                  altitude, a local QNH gives altitude above sea level.
+ * @return Altitude in mm (0 if @p p0_cpa is 0).
+ */
+int32_t baro_alt_mm(uint32_t press_cpa, uint32_t p0_cpa);
+
+/**
+ * Steady-state Kalman gains for a constant-velocity model (Kalata's tracking
+ * index), for samples @p dt_ms apart.
+ *
+ * @param meas_noise_mm     Altitude measurement noise (1 sigma), mm.
+ * @param accel_noise_mm_s2 Unmodelled vertical acceleration (1 sigma), mm/s^2;
+ *                          with an accelerometer input, its noise instead.
+ * @retval 0 on success, -EINVAL if @p meas_noise_mm or @p dt_ms is 0.
+ */
+int baro_alt_filter_gains(struct baro_alt_filter_cfg *cfg, uint32_t meas_noise_mm,
+			  uint32_t accel_noise_mm_s2, uint32_t dt_ms);
+
+/** Reset the filter; the next update seeds the altitude with zero speed. */
+void baro_alt_filter_init(struct baro_alt_filter *f, const struct baro_alt_filter_cfg *cfg);
+
+/**
+ * Feed one altitude sample.
+ *
+ * @param alt_mm      Measured altitude (baro_alt_mm()).
+ * @param accel_mm_s2 Vertical acceleration, gravity removed; 0 without an
+ *                    accelerometer.
+ * @param dt_ms       Time since the previous sample; 0 skips the update.
+ */
+void baro_alt_filter_update(struct baro_alt_filter *f, int32_t alt_mm,
+			    int32_t accel_mm_s2, uint32_t dt_ms);
+
+/** Filtered altitude, mm. */
+int32_t baro_alt_filter_alt_mm(const struct baro_alt_filter *f);
+
+/** Filtered vertical speed, mm/s (positive = climbing). */
+int32_t baro_alt_filter_vspeed_mm_s(const struct baro_alt_filter *f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_BARO_ALT_H_ */
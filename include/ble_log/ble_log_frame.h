@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_BLE_LOG_FRAME_H_
+#define NRFMODULE_BLE_LOG_FRAME_H_
+
+/**
+ * @file ble_log_frame.h
+ * @brief Notification framing for the BLE log backend (pure).
+ *
+ * Log messages (text lines or dictionary records, both self-delimiting) are
+ * packed back to back into frames of up to one ATT payload, one frame per
+ * notification, instead of one message per notification. A message that
+ * does not fit the rest of a frame goes whole into the next one; only a
+ * message larger than a frame is split. Each frame starts with a 4-byte
+ * header:
+ *
+ *   flags  u8   version in the high nibble, BLE_LOG_FRAME_F_* below
+ *   first  u8   payload offset of the first message that starts in this
+ *               frame; BLE_LOG_FRAME_NO_START if none does
+ *   seq    u16  little-endian, +1 per frame, also across dropped frames
+ *
+ * so the host sees a gap in seq and resumes decoding at @c first of the
+ * next frame. scripts/ble_log_client.py is the reference decoder. Pure +
+ * unit-testable: frames go out through a callback.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BLE_LOG_FRAME_VERSION   (1)
+#define BLE_LOG_FRAME_HDR_SIZE  (4)
+/** Largest frame: an ATT MTU of 247 (a 251-byte LL PDU with DLE) less 3. */
+#define BLE_LOG_FRAME_MAX       (244)
+/** Smallest frame: the default ATT MTU of 23 less 3. */
+#define BLE_LOG_FRAME_MIN       (20)
+#define BLE_LOG_FRAME_NO_START  (0xFF)
+
+#define BLE_LOG_FRAME_FLAGS(f) ((uint8_t)((BLE_LOG_FRAME_VERSION << 4) | (f)))
+
+/**
+ * Messages come from the offline store (ble_log_store.h), each prefixed by
+ * BLE_LOG_STORED_HDR_SIZE bytes: its u32 record seq and u16 length, both
+ * little-endian. Record seqs count up across reboots, so the host sees
+ * records lost to wrap-around or flash errors as gaps. An empty message is
+ * the store's replay mark and prints nothing.
+ */
+#define BLE_LOG_FRAME_F_STORED  (0x01)
+
+#define BLE_LOG_STORED_HDR_SIZE (6)
+
+/**
+ * Payload is ble_log_lz tokens (ble_log_lz.h) compressed from a fresh
+ * window; @c first is an offset into the compressed bytes. Messages are
+ * unchanged underneath, including BLE_LOG_FRAME_F_STORED records.
+ */
+#define BLE_LOG_FRAME_F_LZ      (0x02)
+
+/**
+ * Frame holds one drop report instead of messages: u32 little-endian counts
+ * of ERR, WRN, INF and DBG messages shed since the previous report
+ * (ble_log_ring.h).
+ */
+#define BLE_LOG_FRAME_F_DROPS   (0x04)
+
+struct ble_log_lz;
+
+/** Send one frame; return 0, or a negative errno to count it dropped. */
+typedef int (*ble_log_emit_t)(const uint8_t *frame, size_t len, void *ctx);
+
+struct ble_log_packer {
+	uint8_t frame[BLE_LOG_FRAME_MAX];
+	uint16_t len;  /**< Bytes in @c frame, header included; 0 = none open. */
+	uint16_t cap;  /**< Frame size for the current ATT MTU. */
+	uint16_t seq;  /**< Of the next frame. */
+	uint8_t flags; /**< BLE_LOG_FRAME_F_* of the open frame. */
+	uint32_t dropped; /**< Frames the emit callback refused. */
+	struct ble_log_lz *lz; /**< Compressor; NULL = frames go out plain. */
+	ble_log_emit_t emit;
+	void *ctx;
+};
+
+void ble_log_packer_init(struct ble_log_packer *p, ble_log_emit_t emit, void *ctx);
+
+/**
+ * @brief Size frames for @p att_mtu (clamped to the frame limits).
+ *
+ * Flushes the open frame first if it no longer fits.
+ */
+void ble_log_packer_set_mtu(struct ble_log_packer *p, uint16_t att_mtu);
+
+/**
+ * @brief Set BLE_LOG_FRAME_F_* for the messages that follow.
+ *
+ * Flushes the open frame first if the flags change, so a frame never mixes
+ * message kinds.
+ */
+void ble_log_packer_set_flags(struct ble_log_packer *p, uint8_t flags);
+
+/**
+ * @brief Compress the frames that follow with @p lz (NULL: stop).
+ *
+ * Flushes the open frame first. @p lz must outlive its use here.
+ */
+void ble_log_packer_set_lz(struct ble_log_packer *p, struct ble_log_lz *lz);
+
+/** Append one whole message; full frames are emitted as they fill. */
+void ble_log_packer_put(struct ble_log_packer *p, const uint8_t *msg, size_t len);
+
+/** Send a drop report in a frame of its own (BLE_LOG_FRAME_F_DROPS). */
+void ble_log_packer_put_drops(struct ble_log_packer *p, const uint8_t *report, size_t len);
+
+/**
+ * @brief Emit the open frame, if any (end of a burst or a flush timer).
+ *
+ * @return 0, or the emit callback's error.
+ */
+int ble_log_packer_flush(struct ble_log_packer *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_BLE_LOG_FRAME_H_ */
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_BLE_LOG_LINK_H_
+#define NRFMODULE_BLE_LOG_LINK_H_
+
+/**
+ * @file ble_log_link.h
+ * @brief Link tuning for BLE log throughput.
+ *
+ * With the default 23-byte ATT MTU, 27-byte LL PDUs and 1M PHY a
+ * notification carries 20 bytes. On a log subscription this asks the peer
+ * for the largest ATT MTU the build supports, maximum data length (251-byte
+ * PDUs) and 2M PHY, so one frame (ble_log_frame.h) fills a single LL
+ * packet of up to 244 payload bytes sent at twice the rate. Each request needs
+ * its Zephyr option (BT_GATT_CLIENT, BT_USER_DATA_LEN_UPDATE,
+ * BT_USER_PHY_UPDATE) and is skipped without it; the peer may refuse any of
+ * them, and frames follow whatever bt_gatt_get_mtu() reports.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct bt_conn;
+
+/**
+ * @brief Request MTU exchange, data length extension and 2M PHY on @p conn.
+ *
+ * Asynchronous; returns once all requests are queued.
+ *
+ * @return 0, or the first error from the host stack.
+ */
+int ble_log_link_tune(struct bt_conn *conn);
+
+/**
+ * @brief ble_log_link_tune() on every LE connection.
+ *
+ * For the enable event of nrfmodule_ble_log_hook_t, which does not carry the
+ * connection.
+ */
+void ble_log_link_tune_all(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_BLE_LOG_LINK_H_ */
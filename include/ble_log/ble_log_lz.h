@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_BLE_LOG_LZ_H_
+#define NRFMODULE_BLE_LOG_LZ_H_
+
+/**
+ * @file ble_log_lz.h
+ * @brief Per-frame LZ77 compression for BLE log frames (pure).
+ *
+ * A byte-oriented LZ77 in the spirit of LZ4/heatshrink, sized for one
+ * notification: the history restarts at every frame, so each frame decodes
+ * on its own and a lost notification costs only the messages in it. To make
+ * up for the short history, every frame starts from the same primed
+ * window (ble_log_lz_dict) holding the Zephyr text log prefix for each
+ * level, so even the first line of a frame compresses. Tokens:
+ *
+ *   0xxxxxxx              literal run: the next x + 1 bytes
+ *   1lllllxx yyyyyyyy     match: l + 3 bytes (3..34) copied from
+ *                         xxyyyyyyyy + 1 bytes back (1..1024)
+ *
+ * A match may reach into the primed window and may overlap its own output.
+ * Each call to ble_log_lz_compress() ends on a token boundary, so message
+ * starts (the frame's @c first) stay addressable in compressed bytes. The
+ * format and the window are part of the wire format: change them only with
+ * BLE_LOG_FRAME_VERSION. scripts/ble_log_client.py carries a copy of the
+ * decoder.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** History, primed window included: the reach of a match offset. */
+#define BLE_LOG_LZ_WINDOW    (1024)
+#define BLE_LOG_LZ_MIN_MATCH (3)
+#define BLE_LOG_LZ_MAX_MATCH (34)
+#define BLE_LOG_LZ_HASH_BITS (9)
+
+/** Primed window every frame starts from. */
+extern const uint8_t ble_log_lz_dict[];
+extern const size_t ble_log_lz_dict_len;
+
+/** Compressor state, about 4 KB; one per packer. */
+struct ble_log_lz {
+	uint8_t hist[BLE_LOG_LZ_WINDOW];
+	uint16_t hist_len;
+	/* Hash chains over hist, as position + 1 (0 = end of chain). */
+	uint16_t head[1U << BLE_LOG_LZ_HASH_BITS];
+	uint16_t prev[BLE_LOG_LZ_WINDOW];
+};
+
+/** Restart from the primed window (start of a frame). */
+void ble_log_lz_reset(struct ble_log_lz *lz);
+
+/**
+ * @brief Compress as much of @p src as fits @p cap bytes of output.
+ *
+ * The input becomes history for later calls until the next reset. Stops
+ * early when @p dst or the history is full.
+ *
+ * @param consumed  Input bytes the output covers.
+ * @return Output bytes written.
+ */
+size_t ble_log_lz_compress(struct ble_log_lz *lz, const uint8_t *src, size_t len,
+			   uint8_t *dst, size_t cap, size_t *consumed);
+
+/**
+ * @brief Decode one frame payload compressed from a fresh reset.
+ *
+ * @return Decoded length, -EBADMSG for a malformed stream or -ENOBUFS if
+ *         @p cap is too small.
+ */
+int ble_log_lz_decode(const uint8_t *src, size_t len, uint8_t *dst, size_t cap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_BLE_LOG_LZ_H_ */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_BLE_LOG_RING_H_
+#define NRFMODULE_BLE_LOG_RING_H_
+
+/**
+ * @file ble_log_ring.h
+ * @brief Lock-free message ring between the log backend and the BLE sender
+ *        (pure).
+ *
+ * Single producer (the backend's process() path) and single consumer (the
+ * thread that notifies); neither ever blocks or takes a lock, so a slow
+ * link can cost log messages but never stalls a thread that logs. Messages
+ * are stored whole with their level.
+ *
+ * Above the high watermark the ring is congested and sheds by level as it
+ * fills further: DBG first, then INF, then WRN; ERR is only lost when it
+ * does not fit at all. Once the fill drops to the low watermark it is
+ * clear again, and if anything was shed the next put() queues a drop
+ * report (BLE_LOG_RING_DROPS) ahead of its message, in stream order.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Levels as LOG_LEVEL_ERR..LOG_LEVEL_DBG. */
+#define BLE_LOG_RING_LEVELS (4)
+
+/** ble_log_ring_get() level of a drop report. */
+#define BLE_LOG_RING_DROPS  (0)
+
+/** Drop report payload: u32 LE counts shed for ERR, WRN, INF, DBG. */
+#define BLE_LOG_RING_DROPS_SIZE (4 * BLE_LOG_RING_LEVELS)
+
+struct ble_log_ring {
+	uint8_t *buf;
+	uint32_t size;     /**< Power of two. */
+	uint32_t high;     /**< Congested at or above this many bytes used. */
+	uint32_t low;      /**< Clear again at or below this. */
+	atomic_t head;     /**< Written by the producer only. */
+	atomic_t tail;     /**< Written by the consumer only. */
+	/* Producer-owned. */
+	bool congested;
+	uint32_t shed[BLE_LOG_RING_LEVELS];    /**< Since the last drop report. */
+	uint32_t dropped[BLE_LOG_RING_LEVELS]; /**< Since init. */
+	uint32_t peak;     /**< Most bytes ever used. */
+};
+
+/**
+ * @brief Set up @p r over @p buf.
+ *
+ * @param size      Bytes; a power of two and a multiple of 4.
+ * @param high_pct  High watermark, percent of @p size.
+ * @param low_pct   Low watermark, percent of @p size; below @p high_pct.
+ */
+void ble_log_ring_init(struct ble_log_ring *r, uint8_t *buf, uint32_t size,
+		       uint8_t high_pct, uint8_t low_pct);
+
+/**
+ * @brief Queue one message (producer).
+ *
+ * @param level  LOG_LEVEL_ERR (1) .. LOG_LEVEL_DBG (4); others count as DBG.
+ *
+ * @retval 0         Queued.
+ * @retval -ENOSPC   Shed or no room; counted in @c dropped.
+ * @retval -EMSGSIZE Too long for the ring; counted too.
+ */
+int ble_log_ring_put(struct ble_log_ring *r, uint8_t level, const void *msg, size_t len);
+
+/**
+ * @brief Take the oldest message (consumer).
+ *
+ * @param level  Set to the message level, or BLE_LOG_RING_DROPS.
+ * @return Length, -EAGAIN if empty, or -ENOBUFS if @p cap is too small
+ *         (the message is discarded).
+ */
+int ble_log_ring_get(struct ble_log_ring *r, uint8_t *level, void *dst, size_t cap);
+
+/** Bytes queued, record headers included. */
+uint32_t ble_log_ring_used(struct ble_log_ring *r);
+
+/** As of the last put(). */
+static inline bool ble_log_ring_congested(const struct ble_log_ring *r)
+{
+	return r->congested;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_BLE_LOG_RING_H_ */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_BLE_LOG_STORE_H_
+#define NRFMODULE_BLE_LOG_STORE_H_
+
+/**
+ * @file ble_log_store.h
+ * @brief Offline log store for the BLE log backend.
+ *
+ * While no client is subscribed the backend hands each formatted message to
+ * ble_log_store_put(), which appends it as one tlog record (storage/tlog.h)
+ * on a flash partition. tlog stages records in RAM and programs whole pages,
+ * and a flush timer bounds how long a partial batch waits, so a quiet
+ * device wakes the flash once per batch rather than once per line. On
+ * subscribe the backend calls ble_log_store_replay() until it returns 0:
+ * the backlog goes out through the packer in BLE_LOG_FRAME_F_STORED frames,
+ * each message tagged with its record seq, as fast as the emit callback
+ * takes them. Messages logged while a replay is still pending are put()
+ * as well, so the host sees them in order.
+ *
+ * Once a replay catches up, the store appends a mark (an empty record), so
+ * after a reboot replay resumes there instead of sending the whole log
+ * again. The mark itself goes out as an empty message on the next replay.
+ *
+ * All calls come from the backend's processing context; none may run
+ * concurrently.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ble_log_packer;
+
+/**
+ * @brief Mount the store on flash area @p area_id (FIXED_PARTITION_ID()).
+ *
+ * Records already in the area are kept; the next replay starts at the
+ * newest mark. Finding it reads the whole log once.
+ *
+ * @return 0, or the error from tlog_init().
+ */
+int ble_log_store_init(uint8_t area_id);
+
+/**
+ * @brief Store one message for a later replay.
+ *
+ * @retval 0         Staged.
+ * @retval -ENODEV   Not mounted.
+ * @retval -EINVAL   Empty (reserved for marks).
+ * @retval -EMSGSIZE Longer than CONFIG_NRFMODULE_BLE_LOG_STORE_MSG_MAX.
+ * @retval -EIO      Flash error; the message is lost.
+ */
+int ble_log_store_put(const void *msg, uint16_t len);
+
+/**
+ * @brief Send up to @p max_records stored messages through @p p.
+ *
+ * Continues where the previous call stopped. Records that were lost are
+ * skipped; the host sees the missing seqs. The last frame is flushed and the
+ * packer is left with no flags set.
+ *
+ * @return Records still pending (call again), 0 once caught up (send live
+ *         from now on), -EAGAIN if the emit callback refused a frame (call
+ *         again later; replay resumes at that frame's first record), or
+ *         -EIO.
+ */
+int ble_log_store_replay(struct ble_log_packer *p, size_t max_records);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_BLE_LOG_STORE_H_ */
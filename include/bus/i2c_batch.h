@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_I2C_BATCH_H_
+#define NRFMODULE_I2C_BATCH_H_
+
+/**
+ * @file i2c_batch.h
+ * @brief Batched register reads for sensors sharing one I2C bus.
+ *
+ * Each driver transfer otherwise resumes and suspends the TWIM (pins, clock,
+ * EasyDMA) on its own. Drivers and the app queue their per-cycle reads on an
+ * i2c_batch instead; i2c_batch_run() takes one runtime-PM reference on the
+ * bus, issues the whole list back-to-back as write-reg/read transfers, and
+ * releases the bus once. Completions then run in queue order, outside the bus
+ * hold, so a callback may queue its read for the next cycle.
+ *
+ * The TWIM addresses one target per transfer, so the list is one transfer
+ * per read rather than a single bus transaction; the saving is the per-
+ * transfer bus resume/suspend and the scheduling gaps between drivers.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct device;
+struct i2c_batch_read;
+
+/** Completion, called from i2c_batch_run() with @c err set. */
+typedef void (*i2c_batch_done_t)(struct i2c_batch_read *rd);
+
+/**
+ * One queued register read; owned by the batch from i2c_batch_add() until
+ * its completion starts. Do not change its fields in between.
+ */
+struct i2c_batch_read {
+	uint16_t addr;         /**< 7-bit target address */
+	uint8_t reg;           /**< first register (auto-increment burst) */
+	uint8_t len;           /**< bytes to read into @c buf */
+	uint8_t *buf;
+	i2c_batch_done_t done; /**< NULL = none; poll @c err instead */
+	int err;               /**< 0 or negative errno after the run */
+	sys_snode_t node;      /**< batch membership */
+};
+
+/** Pending reads for one bus. */
+struct i2c_batch {
+	const struct device *bus;
+	sys_slist_t reads;   /**< Queued for the next run. */
+	sys_slist_t running; /**< Taken by the current run, until completed. */
+	struct k_mutex lock;
+};
+
+/** Bind @p batch to an I2C controller. */
+void i2c_batch_init(struct i2c_batch *batch, const struct device *bus);
+
+/**
+ * @brief Queue a read for the next i2c_batch_run().
+ *
+ * @retval 0         Queued.
+ * @retval -EINVAL   No buffer or zero length.
+ * @retval -EALREADY @p rd is already queued.
+ * @retval -EBUSY    @p rd is in the running batch and its completion has not
+ *                   started yet.
+ */
+int i2c_batch_add(struct i2c_batch *batch, struct i2c_batch_read *rd);
+
+/**
+ * @brief Run every queued read with the bus held active once.
+ *
+ * Reads queued while it runs go to the next run. One run per batch at a
+ * time.
+ *
+ * @return 0, the first error (each read's own result is in its @c err), or
+ *         -EBUSY if another run of @p batch is in progress.
+ */
+int i2c_batch_run(struct i2c_batch *batch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_I2C_BATCH_H_ */
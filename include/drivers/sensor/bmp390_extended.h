@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file bmp390_extended.h
+ * @brief BMP390 features beyond Zephyr's sensor API (vendored driver only).
+ *
+ * FIFO batching: the sensor keeps sampling at its ODR into its 512-byte
+ * hardware FIFO while the host sleeps; the host then drains every frame with
+ * one burst read instead of one sample_fetch() transaction per sample.
+ *
+ * Sample queue: the INT pin (int-gpios) fires on data-ready, or on the FIFO
+ * watermark while batching; each sample is stamped at interrupt time and
+ * queued for a consumer thread, so periodic sampling needs no host timer.
+ *
+ * Shared-bus batching: the data read joins an i2c_batch with the other
+ * sensors on the bus, so one cycle resumes the TWIM once for all of them.
+ */
+
+#ifndef NRFMODULE_DRIVERS_SENSOR_BMP390_EXTENDED_H_
+#define NRFMODULE_DRIVERS_SENSOR_BMP390_EXTENDED_H_
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Worst-case PM_DEVICE_ACTION_TURN_ON re-init after a rail gate, in ms: soft
+ * reset plus register restore (calibration is cached). Declare it as the
+ * instance's rail_user reinit_ms (<power/rail.h>).
+ */
+#define BMP390_REINIT_MS 3
+
+/** Frames (pressure + temperature) the FIFO holds before it is full. */
+#define BMP390_FIFO_MAX_FRAMES 73
+
+/** sensor_time value when no sensortime frame came with the drain. */
+#define BMP390_SENSOR_TIME_INVALID UINT32_MAX
+
+/**
+ * @brief One compensated FIFO sample.
+ */
+struct bmp390_frame {
+	/** Pressure in hundredths of a pascal. */
+	uint32_t press_cpa;
+
+	/** Temperature in thousandths of a degree Celsius. */
+	int32_t temp_mdegc;
+
+	/**
+	 * Sensor time of the sample: 24-bit counter at 25.6 kHz (39.0625 us per
+	 * tick, wraps every ~655 s), back-dated from the drain's sensortime
+	 * frame by one ODR period per newer frame. BMP390_SENSOR_TIME_INVALID
+	 * if the drain stopped short of the sensortime frame.
+	 */
+	uint32_t sensor_time;
+};
+
+/**
+ * @brief Start FIFO batching.
+ *
+ * Flushes the FIFO and enables pressure + temperature + sensortime frames
+ * (IIR-filtered data). The configuration survives a rail power-cycle: it is
+ * re-applied on PM_DEVICE_ACTION_TURN_ON.
+ *
+ * @param dev         BMP390 device.
+ * @param wtm_frames  Watermark in frames, 1..BMP390_FIFO_MAX_FRAMES; raises
+ *                    the FIFO watermark interrupt status when reached.
+ *
+ * @retval 0        Success.
+ * @retval -EINVAL  Watermark out of range.
+ * @retval -EIO     Bus error.
+ */
+int bmp390_fifo_start(const struct device *dev, uint16_t wtm_frames);
+
+/**
+ * @brief Stop FIFO batching and flush what is left.
+ *
+ * @retval 0     Success.
+ * @retval -EIO  Bus error.
+ */
+int bmp390_fifo_stop(const struct device *dev);
+
+/**
+ * @brief Drain the FIFO with one burst read and compensate each frame.
+ *
+ * Frames come out oldest first. If more frames are queued than @p max_frames,
+ * only the oldest @p max_frames are read (no sensortime); the rest stay queued
+ * for the next call.
+ *
+ * @param dev         BMP390 device.
+ * @param frames      Output array.
+ * @param max_frames  Capacity of @p frames.
+ *
+ * @return Number of frames written (0 = FIFO empty), or negative errno:
+ *         -EACCES if FIFO batching is not started, -EIO on bus error.
+ */
+int bmp390_fifo_read(const struct device *dev, struct bmp390_frame *frames,
+		     size_t max_frames);
+
+/**
+ * @brief One queued sample.
+ */
+struct bmp390_sample {
+	/** Pressure in hundredths of a pascal. */
+	uint32_t press_cpa;
+
+	/** Temperature in thousandths of a degree Celsius. */
+	int32_t temp_mdegc;
+
+	/**
+	 * Uptime in ns when the sample was taken: the interrupt time for
+	 * data-ready. FIFO frames are spaced one ODR period apart, anchored so
+	 * the frame that reached the watermark carries the interrupt time.
+	 */
+	int64_t timestamp_ns;
+};
+
+/**
+ * @brief Start or stop the interrupt-driven sample queue.
+ *
+ * Enables the data-ready interrupt, or the FIFO watermark interrupt while
+ * FIFO batching is running (the queue then owns draining the FIFO; do not
+ * call bmp390_fifo_read() concurrently). Stopping keeps queued samples.
+ * Requires CONFIG_NRFMODULE_BMP390_TRIGGER. Not available with
+ * CONFIG_NRFMODULE_BMP390_FORCED_MODE, where the chip converts only inside
+ * sample_fetch() and no data-ready interrupt arrives on its own.
+ *
+ * @retval 0        Success.
+ * @retval -ENOTSUP No int-gpios on this instance, or forced mode.
+ * @retval -EIO     Bus or GPIO error.
+ */
+int bmp390_queue_enable(const struct device *dev, bool enable);
+
+/**
+ * @brief Take the oldest queued sample.
+ *
+ * Single consumer: call from one thread only.
+ *
+ * @retval 0        @p sample filled.
+ * @retval -EAGAIN  Nothing queued within @p timeout.
+ */
+int bmp390_queue_get(const struct device *dev, struct bmp390_sample *sample,
+		     k_timeout_t timeout);
+
+/**
+ * @brief Samples lost because the queue was full, since init.
+ */
+uint32_t bmp390_queue_dropped(const struct device *dev);
+
+struct i2c_batch;
+
+/**
+ * @brief Queue this instance's data read on a shared-bus batch.
+ *
+ * When the batch runs, the sample is stored as if by sensor_sample_fetch(),
+ * so sensor_channel_get() returns it. Call again each cycle. Requires
+ * CONFIG_NRFMODULE_I2C_BATCH; normal mode only (the data registers always
+ * hold the latest conversion), so not with forced-mode sampling.
+ *
+ * @retval 0         Queued.
+ * @retval -ENOTSUP  SPI instance or forced mode.
+ * @retval -EINVAL   @p batch is for another bus.
+ * @retval -EALREADY Already queued for this run.
+ * @retval -EBUSY    A run in progress has not completed it yet.
+ */
+int bmp390_batch_add(const struct device *dev, struct i2c_batch *batch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_DRIVERS_SENSOR_BMP390_EXTENDED_H_ */
@@ -11,6 +11,10 @@
  * @brief Pure priority arbiter for LED effects (no hardware).
  *
  * Each source owns a layer; the arbiter shows the highest-priority active layer.
+ * By default a layer is opaque (LED_BLEND_REPLACE); a layer given another blend
+ * mode instead composites over the live layers below it, down to the nearest
+ * opaque one, so small orthogonal effects (e.g. a low-battery pulse over the
+ * charging colour) combine without a hand-built combined effect.
  * Layers are plain priority indices (0 = lowest, higher wins) — the application
  * defines what each layer means (e.g. an enum mapping charging/BLE/error onto
  * indices). Transient layers retire automatically — by a time limit, or when a
@@ -24,17 +28,30 @@
  * sizes struct led_arbiter, so it comes from Kconfig — one value build-wide. */
 #define LED_ARBITER_MAX_LAYERS CONFIG_NRFMODULE_LED_ARBITER_MAX_LAYERS
 
+/** How a layer combines with the composite of the live layers below it. */
+enum led_blend {
+	LED_BLEND_REPLACE = 0, /**< Opaque: hides everything below (default). */
+	LED_BLEND_ALPHA,       /**< Cross-fade toward this layer by its weight. */
+	LED_BLEND_ADD,         /**< Add this layer scaled by its weight, saturating. */
+	LED_BLEND_MULTIPLY,    /**< Tint below by this layer, mixed in by weight. */
+	LED_BLEND_SCALE,       /**< Dim below by this layer's brightness x weight. */
+};
+
 struct led_slot {
 	const struct led_effect *effect; /**< NULL = inactive. */
 	uint32_t start_ms;
 	uint32_t expire_ms;              /**< 0 = no time limit. */
+	uint32_t run_ms;                 /**< Run-once pass length; 0 = never finishes. */
+	uint8_t blend;                   /**< enum led_blend; kept across set/clear. */
+	uint8_t weight;                  /**< 0..255 blend weight (255 = full). */
 };
 
 struct led_arbiter {
 	struct led_slot slots[LED_ARBITER_MAX_LAYERS];
+	uint32_t set_mask;               /**< Bit l: slots[l] holds an effect. */
 };
 
-/** Clear all layers. */
+/** Clear all layers; every layer back to opaque (LED_BLEND_REPLACE). */
 void led_arbiter_init(struct led_arbiter *a);
 
 /**
@@ -51,12 +68,24 @@ void led_arbiter_set(struct led_arbiter *a, uint8_t layer,
 void led_arbiter_clear(struct led_arbiter *a, uint8_t layer);
 
 /**
- * @brief Render the winning layer at @p now_ms, retiring expired/finished
- *        transient layers as a side effect.
+ * @brief Set how @p layer composites over the layers below it.
+ *
+ * A property of the layer, not of the effect: it survives set/clear, so a
+ * product declares its overlay layers once at init.
+ *
+ * @param weight  0..255 strength of the blend (ignored for REPLACE).
+ */
+void led_arbiter_set_blend(struct led_arbiter *a, uint8_t layer,
+			   enum led_blend blend, uint8_t weight);
+
+/**
+ * @brief Render the composite at @p now_ms: the topmost live opaque layer with
+ *        the live blended layers above it folded on, bottom-up. Retires
+ *        expired/finished transient layers it passes as a side effect.
  */
 struct led_color led_arbiter_render(struct led_arbiter *a, uint32_t now_ms);
 
-/** The winning layer index at @p now_ms, or -1 if none (no mutation). */
+/** The topmost live layer index at @p now_ms, or -1 if none (no mutation). */
 int led_arbiter_active(const struct led_arbiter *a, uint32_t now_ms);
 
 #endif /* NRFMODULE_LED_ARBITER_H_ */
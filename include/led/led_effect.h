@@ -43,11 +43,18 @@ struct led_effect {
 	const struct led_effect_step *steps;
 	uint16_t step_count;
 	bool loop;                /**< Restart after the last step (else run once). */
+	/** Optional running sum of step durations (entry i = end of step i), as
+	 *  emitted by scripts/gen_led_effects.py; lets the renderer binary-search
+	 *  instead of summing. NULL = summed at render time. */
+	const uint32_t *step_end_ms;
 };
 
 /* ---- effect builders (CAF-style; compound-literal step arrays) ------------
  * These build static effect tables, so use them only at file scope: the step
  * arrays are compound literals, which have automatic storage inside a function.
+ * For tables shared across boards, prefer a YAML file run through
+ * CONFIG_NRFMODULE_LED_EFFECTS_FILE: it is checked at build time and emits the
+ * step_end_ms sums.
  */
 
 /* Braced initializer (not a compound literal) so it is a constant expression
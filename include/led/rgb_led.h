@@ -11,7 +11,8 @@
  * @brief One PWM RGB LED = priority arbiter rendered onto three PWM channels.
  *
  * The engine: it owns an arbiter, the PWM seam, a self-arming tick, and a lock.
- * All state is per-instance, so N physical LEDs = N rgb_led objects. The pure,
+ * All state is per-instance, so N physical LEDs = N rgb_led objects; to drive
+ * many of them from one clock, add them to an rgb_led_group. The pure,
  * unit-tested logic lives in led_effect / led_arbiter; this is the hardware
  * seam. Effect tables and signal→layer mapping are the caller's policy.
  *
@@ -28,8 +29,10 @@
 #include <led/led_effect.h>
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
 
 struct device;
+struct rgb_led_group;
 
 struct rgb_led {
 	const struct device *pwm; /**< a pwm-leds node */
@@ -37,6 +40,21 @@ struct rgb_led {
 	uint8_t ch_g;
 	uint8_t ch_b;
 	struct led_arbiter arbiter;
+	struct k_work_delayable tick; /**< own tick; idle once in a group */
+	struct k_mutex lock;
+	struct rgb_led_group *group;  /**< NULL = standalone */
+	sys_snode_t node;             /**< group membership */
+};
+
+/**
+ * @brief Shared render clock for several rgb_led instances (a panel, a light bar).
+ *
+ * One delayable work renders every member in a single pass, so N LEDs cost one
+ * wakeup per tick instead of N unaligned ones. Member locks are taken only
+ * around each member's render; the group lock guards membership.
+ */
+struct rgb_led_group {
+	sys_slist_t leds;
 	struct k_work_delayable tick;
 	struct k_mutex lock;
 };
@@ -56,4 +74,24 @@ void rgb_led_set(struct rgb_led *led, uint8_t layer,
 /** Drop @p layer (reverts to the next live one). */
 void rgb_led_clear(struct rgb_led *led, uint8_t layer);
 
+/** Set how @p layer composites over the layers below it; see led_arbiter.h. */
+void rgb_led_set_blend(struct rgb_led *led, uint8_t layer, enum led_blend blend,
+		       uint8_t weight);
+
+/** Empty group, tick idle until a member is set. */
+void rgb_led_group_init(struct rgb_led_group *group);
+
+/**
+ * @brief Move an initialised @p led onto @p group's clock.
+ *
+ * The LED's own tick is stopped; from now on rgb_led_set()/rgb_led_clear() on
+ * it kick the group tick instead. An LED joins at most one group, for good.
+ * Waits for a running tick of the LED, so do not call it from the system
+ * work queue.
+ *
+ * @retval 0          Added.
+ * @retval -EALREADY  @p led is already in a group.
+ */
+int rgb_led_group_add(struct rgb_led_group *group, struct rgb_led *led);
+
 #endif /* NRFMODULE_RGB_LED_H_ */
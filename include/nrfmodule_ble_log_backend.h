@@ -16,9 +16,45 @@
  * so both can run simultaneously:
  *   - Shell: standard NUS UUID (0x6E400001...9E)
  *   - Logs:  custom UUID       (0x6E400001...00)
+ *
+ * The backend in nrfmodule-core still sends each formatted message as its
+ * own notification. The libraries under lib/ble_log are the contract it has
+ * yet to adopt; none of this happens until it does:
+ *   - Framing (<ble_log/ble_log_frame.h>): several messages per MTU-sized
+ *     notification, with ble_log_link_tune_all() (<ble_log/ble_log_link.h>)
+ *     called from the enable hook so frames can grow past 20 bytes.
+ *   - NRFMODULE_BLE_LOG_STORE: messages logged while nobody is subscribed
+ *     go to flash (<ble_log/ble_log_store.h>), replayed on the next
+ *     subscribe.
+ *   - NRFMODULE_BLE_LOG_LZ: the packer compresses each frame
+ *     (ble_log_packer_set_lz()).
+ *   - NRFMODULE_BLE_LOG_RING: messages reach the sender through a lock-free
+ *     ring (<ble_log/ble_log_ring.h>) that sheds low levels first when the
+ *     link falls behind, so logging never waits for the radio.
+ * scripts/ble_log_client.py reads the current stream by default and the
+ * framed one with --framed.
  */
 
 #include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Log output format id the backend formats with.
+ *
+ * From CONFIG_LOG_BACKEND_NRFMODULE_BLE_LOG_OUTPUT (lib/ble_log/Kconfig),
+ * for the backend to pass to log_format_func_t_get(). With dictionary
+ * output the device would send binary messages (string addresses plus
+ * arguments) and do no formatting at all, decoded with
+ * scripts/ble_log_client.py --dictionary build/zephyr/log_dictionary.json.
+ *
+ * @note The backend does not read this yet and always formats text;
+ *       dictionary output waits on that change in nrfmodule-core.
+ */
+#if defined(CONFIG_LOG_BACKEND_NRFMODULE_BLE_LOG_OUTPUT_DEFAULT)
+#define NRFMODULE_BLE_LOG_OUTPUT_FORMAT CONFIG_LOG_BACKEND_NRFMODULE_BLE_LOG_OUTPUT_DEFAULT
+#else
+#define NRFMODULE_BLE_LOG_OUTPUT_FORMAT 0 /* LOG_OUTPUT_TEXT */
+#endif
 
 /**
  * @brief Raw advertising UUID data for the nRFModule BLE log service.
@@ -45,4 +81,43 @@ typedef void (*nrfmodule_ble_log_hook_t)(bool enabled, void *ctx);
  */
 void nrfmodule_ble_log_set_hook(nrfmodule_ble_log_hook_t hook, void *ctx);
 
+/**
+ * @brief Hook called when the link falls behind or catches up.
+ *
+ * Called from the backend's processing context, on the high and low
+ * watermark crossings of the message queue.
+ *
+ * @param congested  true while messages are being shed
+ * @param ctx        User context passed to nrfmodule_ble_log_set_congestion_hook()
+ */
+typedef void (*nrfmodule_ble_log_congestion_hook_t)(bool congested, void *ctx);
+
+/**
+ * @brief Register a hook for congestion changes.
+ *
+ * The in-tree default (lib/ble_log/ble_log_backend_weak.c) ignores it: the
+ * hook is only called once the backend queues through ble_log_ring.
+ *
+ * @param hook  Callback function
+ * @param ctx   User context
+ */
+void nrfmodule_ble_log_set_congestion_hook(nrfmodule_ble_log_congestion_hook_t hook, void *ctx);
+
+/** @brief Backend load counters. */
+struct nrfmodule_ble_log_stats {
+	bool congested;
+	uint32_t dropped[4];  /**< Messages shed since boot: ERR, WRN, INF, DBG. */
+	uint32_t peak_bytes;  /**< Highest queue fill since boot. */
+	uint32_t queue_bytes; /**< CONFIG_NRFMODULE_BLE_LOG_RING_SIZE. */
+};
+
+/**
+ * @brief Read the load counters.
+ *
+ * @param stats  Filled on success
+ * @return 0, or -ENOTSUP while the backend does not queue through
+ *         ble_log_ring (the in-tree default)
+ */
+int nrfmodule_ble_log_get_stats(struct nrfmodule_ble_log_stats *stats);
+
 #endif /* NRFMODULE_BLE_LOG_BACKEND_H_ */
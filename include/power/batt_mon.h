@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_BATT_MON_H_
+#define NRFMODULE_BATT_MON_H_
+
+/**
+ * @file batt_mon.h
+ * @brief Battery monitor on the board's voltage-divider node.
+ *
+ * One SAADC conversion per sample, hardware-oversampled in burst mode, on a
+ * period posted to the wake coordinator (<power/wake_coord.h>). With
+ * CONFIG_NRFMODULE_BATT_MON_MODEM_IDLE a sample is only taken while the
+ * modem reports IDLE, since TX current sags the cell; a busy modem pushes
+ * the sample back rather than polluting the estimate. After
+ * CONFIG_NRFMODULE_BATT_MON_MAX_DEFERRALS retries it gives up until the next
+ * period, and that sample is taken whatever the modem state and flagged as
+ * taken under load. The filter and SoC curve live in batt_soc; this is the
+ * hardware seam.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct batt_mon_state {
+	uint16_t mv;       /**< Filtered cell voltage. */
+	uint8_t soc_pct;   /**< From batt_soc_lipo. */
+	int64_t taken_ms;  /**< Uptime of the last accepted sample. */
+	bool under_load;   /**< The modem was busy during it. */
+};
+
+/**
+ * @brief Set up the ADC channel, take a first sample, start the period.
+ *
+ * The first sample is taken whatever the modem state, so there is an
+ * estimate from boot.
+ *
+ * @retval -ENODEV ADC not ready.
+ * @retval -ENOMEM No wake coordinator client slot left.
+ */
+int batt_mon_init(void);
+
+/**
+ * @brief Latest filtered estimate.
+ *
+ * @retval -ENODATA No sample accepted yet.
+ */
+int batt_mon_get(struct batt_mon_state *state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_BATT_MON_H_ */
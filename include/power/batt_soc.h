@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_BATT_SOC_H_
+#define NRFMODULE_BATT_SOC_H_
+
+/**
+ * @file batt_soc.h
+ * @brief Battery state of charge from voltage, plus a smoothing filter (pure).
+ *
+ * SoC is a piecewise-linear lookup on a voltage curve (integer only, no
+ * model fitting at runtime). The filter is an integer exponential moving
+ * average seeded by the first sample, so a fresh boot reports at once.
+ * Pure + unit-testable.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** One point of a discharge curve; tables run from full to empty. */
+struct batt_soc_point {
+	uint16_t mv;
+	uint8_t pct;
+};
+
+/** Single-cell LiPo at light load (rested, ~C/50), 4.20 V full to 3.30 V empty. */
+extern const struct batt_soc_point batt_soc_lipo[];
+extern const size_t batt_soc_lipo_len;
+
+/**
+ * @brief State of charge for @p mv on @p curve, 0..100.
+ *
+ * Interpolates between neighbouring points; clamps above the first and
+ * below the last.
+ */
+uint8_t batt_soc_from_mv(const struct batt_soc_point *curve, size_t n, uint16_t mv);
+
+struct batt_filter {
+	uint32_t mv_q8;  /**< Estimate, mV in Q8. */
+	uint8_t shift;   /**< Smoothing: each sample moves it 1 / 2^shift. */
+	bool primed;
+};
+
+/** Reset; @p shift 0 = no smoothing. */
+void batt_filter_init(struct batt_filter *f, uint8_t shift);
+
+/** Feed one reading; returns the filtered voltage in mV. */
+uint16_t batt_filter_update(struct batt_filter *f, uint16_t mv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_BATT_SOC_H_ */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_RAIL_H_
+#define NRFMODULE_RAIL_H_
+
+/**
+ * @file rail.h
+ * @brief Refcounted switched power rail (a regulator-fixed load switch).
+ *
+ * Consumers hold the rail with rail_get()/rail_put() around their bus work
+ * and declare their next use with rail_schedule(). When the last holder
+ * lets go, rail_policy decides whether to gate now or linger until the next
+ * declared use, and the rail's wake_coord client powers it back up early
+ * enough for the consumer to be ready on time. Gating runs each consumer
+ * device through PM SUSPEND + TURN_OFF; power-up through TURN_ON + RESUME,
+ * which is where drivers such as the BMP390 re-initialise. The pure policy
+ * lives in rail_policy; this is the hardware seam.
+ */
+
+#include <power/rail_policy.h>
+#include <power/wake_coord.h>
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct device;
+struct rail;
+
+/** One consumer of a rail. Fill @c dev and @c reinit_ms, then rail_user_add(). */
+struct rail_user {
+	const struct device *dev; /**< Driven through PM on gate/power-up; NULL = none. */
+	uint32_t reinit_ms;       /**< Declared cost to re-init after a gate. */
+	struct rail *rail;
+	int64_t next_need_ms;     /**< RAIL_NEVER = nothing scheduled. */
+	bool held;
+};
+
+struct rail {
+	const struct device *regulator;
+	struct rail_policy_cfg cfg;
+	struct rail_user *users[CONFIG_NRFMODULE_RAIL_MAX_USERS];
+	uint8_t user_count;
+	uint16_t refs;
+	bool on;
+	struct wake_client waker; /**< Runs the policy at the plan's eval time. */
+	struct k_mutex lock;
+};
+
+/**
+ * @brief Take over @p regulator.
+ *
+ * A rail already on (regulator-boot-on) stays on, so drivers probed at boot
+ * keep their state, and is gated on the first evaluation with no need.
+ * Registers the rail as a wake coordinator client, which fails with
+ * -ENOMEM once CONFIG_NRFMODULE_WAKE_COORD_MAX_CLIENTS are taken.
+ *
+ * @param cfg Horizon and settle time; settle_ms should match the node's
+ *            off-on-delay-us.
+ */
+int rail_init(struct rail *rail, const struct device *regulator,
+	      const struct rail_policy_cfg *cfg);
+
+/**
+ * @brief Register a consumer.
+ *
+ * @retval 0       Added.
+ * @retval -ENOMEM CONFIG_NRFMODULE_RAIL_MAX_USERS reached.
+ */
+int rail_user_add(struct rail *rail, struct rail_user *user);
+
+/**
+ * @brief Hold the rail, powering it (and re-initialising consumers) if off.
+ *
+ * Blocks for the rail settle time when it has to power up. Claims the
+ * user's scheduled need.
+ *
+ * @return 0, or a negative errno from the regulator.
+ */
+int rail_get(struct rail_user *user);
+
+/** Release the hold; the rail gates now or lingers per the policy. */
+void rail_put(struct rail_user *user);
+
+/**
+ * @brief Declare the user's next use at uptime @p at_ms (RAIL_NEVER = none).
+ *
+ * Uses close together share one rail-on window; an off rail is powered
+ * up settle + reinit_ms ahead of @p at_ms.
+ */
+void rail_schedule(struct rail_user *user, int64_t at_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_RAIL_H_ */
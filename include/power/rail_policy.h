@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_RAIL_POLICY_H_
+#define NRFMODULE_RAIL_POLICY_H_
+
+/**
+ * @file rail_policy.h
+ * @brief Pure gating policy for a shared, switched power rail (no hardware).
+ *
+ * Gating a rail saves leakage but costs the settle time plus each consumer's
+ * re-init on the way back. With no holder, the rail therefore stays on while
+ * a consumer has declared a need closer than horizon + its re-init cost, and
+ * turns on early enough (settle + re-init) to have that consumer ready on
+ * time. Needs landing close together share one rail-on window. A need not
+ * claimed within the horizon after its time is dropped, so a missed read
+ * cannot pin the rail on. Pure + unit-testable: time is passed in.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** No need declared / nothing to re-evaluate. */
+#define RAIL_NEVER INT64_MAX
+
+struct rail_policy_cfg {
+	uint32_t horizon_ms; /**< Linger budget beyond the re-init cost. */
+	uint32_t settle_ms;  /**< Rail off-on delay before consumers can re-init. */
+};
+
+/** One consumer's declared next use. */
+struct rail_need {
+	int64_t at_ms;      /**< Uptime of the next use; RAIL_NEVER = none. */
+	uint32_t reinit_ms; /**< Declared cost to bring it back after a gate. */
+};
+
+/** What the rail should do now, and when to ask again. */
+struct rail_plan {
+	bool on;
+	int64_t eval_at_ms; /**< RAIL_NEVER = only on the next get/put/schedule. */
+};
+
+/**
+ * @brief Decide the rail state at @p now_ms.
+ *
+ * @param on    Current rail state: an on rail lingers over the wider
+ *              horizon window, an off rail waits for the pre-warm time.
+ * @param refs  Current holders; any holder keeps the rail on.
+ * @param needs Declared needs, one per consumer (unsorted).
+ */
+struct rail_plan rail_policy_plan(const struct rail_policy_cfg *cfg, bool on, uint16_t refs,
+				  const struct rail_need *needs, size_t n, int64_t now_ms);
+
+#endif /* NRFMODULE_RAIL_POLICY_H_ */
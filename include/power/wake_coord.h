@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_WAKE_COORD_H_
+#define NRFMODULE_WAKE_COORD_H_
+
+/**
+ * @file wake_coord.h
+ * @brief System-wide wake coordinator.
+ *
+ * Subsystems with periodic or deferred work (modem housekeeping, GNSS
+ * fixes, sensor reads, LED refresh, USB polling) register a client and
+ * post their next required wake as a deadline plus slack, instead of each
+ * arming its own timer. The coordinator keeps one timer on the earliest
+ * deadline and runs every client whose window is open in that wake, so
+ * the per-wake cost (clock start-up, cache refill, rail settle) is paid
+ * once per window. Each wake records which client's deadline caused it.
+ * Alignment is wake_plan; this is the kernel seam.
+ */
+
+#include <stdint.h>
+
+#include <power/wake_plan.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wake_client;
+
+/** Runs on the system workqueue; may post the next request. */
+typedef void (*wake_client_fn_t)(struct wake_client *client);
+
+/** One subsystem. Fill @c name and @c fn, then wake_coord_add(). */
+struct wake_client {
+	const char *name;
+	wake_client_fn_t fn;
+	int64_t at_ms;    /**< Pending deadline; WAKE_NEVER = none. */
+	uint32_t slack_ms;
+	uint32_t caused;  /**< Wakes this client's deadline set. */
+	uint32_t joined;  /**< Wakes it rode on without causing them. */
+};
+
+/**
+ * @brief Register a client.
+ *
+ * @retval -ENOMEM CONFIG_NRFMODULE_WAKE_COORD_MAX_CLIENTS reached.
+ */
+int wake_coord_add(struct wake_client *client);
+
+/**
+ * @brief Post the client's next wake: by @p at_ms, not before
+ *        @p at_ms - @p slack_ms. Replaces any pending request.
+ */
+void wake_coord_request(struct wake_client *client, int64_t at_ms, uint32_t slack_ms);
+
+/** Drop the client's pending request. */
+void wake_coord_cancel(struct wake_client *client);
+
+/**
+ * @brief The CPU is awake anyway (an interrupt, a radio event, an LED
+ *        frame): run every client whose window is already open, ahead of
+ *        its timer.
+ *
+ * ISR-safe, and cheap while no window is open, so it may be called often.
+ */
+void wake_coord_opportunity(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_WAKE_COORD_H_ */
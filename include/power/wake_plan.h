@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_WAKE_PLAN_H_
+#define NRFMODULE_WAKE_PLAN_H_
+
+/**
+ * @file wake_plan.h
+ * @brief Pure wake alignment for the wake coordinator (no kernel).
+ *
+ * Each request is a window: it must be served by its deadline and may be
+ * served up to slack earlier. The next wake goes at the earliest deadline,
+ * which is never later than any request allows, and serves every request
+ * whose window is open by then, so requests with enough slack share one
+ * wake instead of each paying its own. Picking the earliest deadline each
+ * time gives the fewest wakes for a given set of windows. Pure +
+ * unit-testable: time is passed in.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** No request / no wake pending. */
+#define WAKE_NEVER INT64_MAX
+
+/** At most this many requests per plan (one bit each in a mask). */
+#define WAKE_PLAN_MAX_REQS (32)
+
+struct wake_req {
+	int64_t at_ms;     /**< Deadline (uptime); WAKE_NEVER = none. */
+	uint32_t slack_ms; /**< May be served this much before @c at_ms. */
+};
+
+struct wake_plan {
+	int64_t at_ms;   /**< WAKE_NEVER = nothing pending. */
+	uint32_t served; /**< Bit i: request i runs in this wake. */
+	int cause;       /**< Request whose deadline set @c at_ms; -1 = none. */
+};
+
+/** Mask of requests whose window is open at @p now_ms. */
+uint32_t wake_plan_due(const struct wake_req *reqs, size_t n, int64_t now_ms);
+
+/**
+ * @brief Next wake for @p reqs (n <= WAKE_PLAN_MAX_REQS).
+ *
+ * Ties on the deadline go to the lower index.
+ */
+struct wake_plan wake_plan_next(const struct wake_req *reqs, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_WAKE_PLAN_H_ */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_TLOG_H_
+#define NRFMODULE_TLOG_H_
+
+/**
+ * @file tlog.h
+ * @brief Append-only telemetry record log on a NOR flash partition.
+ *
+ * Appends are encoded (CRC'd record, see tlog_format.h) into a RAM staging
+ * buffer and reach flash only when the buffer fills or on tlog_flush(); a
+ * full buffer writes only whole program pages and keeps the tail staged.
+ * Every flush, sector switch, read and the mount scan run under one
+ * runtime-PM hold of the flash device, so a QSPI NOR with deep power-down
+ * (has-dpd) wakes once per batch instead of once per program operation.
+ * The sector after the head is kept erased ahead of time; when the ring
+ * wraps, the oldest sector is dropped. Records lost to a power cut are the
+ * staged ones only.
+ *
+ * The partition comes from the application's overlay (a fixed-partitions
+ * child of the flash node, e.g. on livetracker's mx25r64).
+ */
+
+#include <storage/tlog_format.h>
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct flash_area;
+
+struct tlog {
+	const struct flash_area *fa;
+	uint32_t sector_size;
+	uint16_t sector_count;
+	struct tlog_index_entry index[CONFIG_NRFMODULE_TLOG_MAX_SECTORS];
+	uint16_t head;         /**< Sector being appended to. */
+	uint32_t head_off;     /**< First unwritten byte in the head sector. */
+	uint32_t next_seq;     /**< Seq the next append gets. */
+	uint8_t stage[CONFIG_NRFMODULE_TLOG_STAGE_SIZE];
+	uint16_t stage_len;    /**< Staged bytes, destined for head_off onward. */
+	/* Sequential-read cursor: where record rd_seq starts. */
+	bool rd_valid;
+	uint16_t rd_sector;
+	uint32_t rd_off;
+	uint32_t rd_seq;
+	struct k_mutex lock;
+	/** Set before tlog_init() to never log, e.g. when storing for a log
+	 *  backend. */
+	bool quiet;
+};
+
+/**
+ * @brief Mount the log on flash area @p area_id (FIXED_PARTITION_ID()).
+ *
+ * Reads one header per sector to build the index, then walks the newest
+ * sector to find the append point. An unformatted partition starts empty.
+ *
+ * @retval 0        Mounted.
+ * @retval -EINVAL  More sectors than CONFIG_NRFMODULE_TLOG_MAX_SECTORS, or
+ *                  fewer than two.
+ * @retval -EIO     Flash error.
+ */
+int tlog_init(struct tlog *log, uint8_t area_id);
+
+/**
+ * @brief Append one record (staged in RAM; see tlog_flush()).
+ *
+ * @retval 0         Staged.
+ * @retval -EMSGSIZE @p len does not fit one record or the staging buffer.
+ * @retval -EIO      A flush it needed failed; the record is not stored.
+ */
+int tlog_append(struct tlog *log, const void *data, uint16_t len);
+
+/** Write everything staged. */
+int tlog_flush(struct tlog *log);
+
+/**
+ * @brief Read record @p seq into @p buf (flushes staged records first).
+ *
+ * Reading seq, seq + 1, ... in order continues from a cursor instead of
+ * walking the sector.
+ *
+ * @return Payload length, or -ENODATA (not written yet), -ENOENT (dropped
+ *         by wrap-around or lost), -ENOBUFS (@p cap too small), -EBADMSG
+ *         (CRC mismatch) or -EIO.
+ */
+int tlog_read(struct tlog *log, uint32_t seq, void *buf, size_t cap);
+
+/** Oldest seq still stored. */
+uint32_t tlog_oldest_seq(struct tlog *log);
+
+/** Seq the next append gets (one past the newest). */
+uint32_t tlog_next_seq(struct tlog *log);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_TLOG_H_ */
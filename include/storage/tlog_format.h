@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_TLOG_FORMAT_H_
+#define NRFMODULE_TLOG_FORMAT_H_
+
+/**
+ * @file tlog_format.h
+ * @brief On-flash layout of the telemetry log, and its sector index (pure).
+ *
+ * The partition is a ring of erase sectors. Each written sector starts with
+ * a tlog_sector_hdr carrying an erase generation (1, 2, ... in write order)
+ * and the sequence number of its first record, followed by records packed
+ * back to back, never straddling a sector. The first erased record header
+ * ends a sector. One RAM index entry per sector (generation + first seq)
+ * finds the newest sector at mount and the sector holding any seq with a
+ * binary search, without touching flash. Pure + unit-testable.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TLOG_SECTOR_MAGIC (0x474F4C54U) /* "TLOG" */
+#define TLOG_REC_MAGIC    (0xA55AU)
+
+/** Records are padded to this, so headers stay word-aligned in flash. */
+#define TLOG_ALIGN        (4U)
+
+/** Largest payload one record holds. */
+#define TLOG_REC_MAX_LEN  (1024U)
+
+struct tlog_sector_hdr {
+	uint32_t magic;
+	uint32_t gen;       /**< Erase generation, 1-based; 0 = never written. */
+	uint32_t first_seq; /**< Seq of the first record in this sector. */
+	uint32_t crc;       /**< CRC-32 of the fields above. */
+};
+
+struct tlog_rec_hdr {
+	uint16_t magic;
+	uint16_t len;       /**< Payload bytes, before padding. */
+	uint32_t seq;
+	uint32_t crc;       /**< CRC-32 of len, seq and the payload. */
+};
+
+/** Index entry for one sector; gen == 0 = erased or unreadable. */
+struct tlog_index_entry {
+	uint32_t gen;
+	uint32_t first_seq;
+};
+
+/** Bytes a record with @p len payload bytes takes in flash. */
+static inline size_t tlog_rec_size(size_t len)
+{
+	return sizeof(struct tlog_rec_hdr) + ((len + TLOG_ALIGN - 1) & ~(size_t)(TLOG_ALIGN - 1));
+}
+
+/** Fill a sector header. */
+void tlog_sector_hdr_init(struct tlog_sector_hdr *hdr, uint32_t gen, uint32_t first_seq);
+
+/** True if @p hdr is a sector header with a good CRC. */
+bool tlog_sector_hdr_valid(const struct tlog_sector_hdr *hdr);
+
+/**
+ * @brief Encode a record (header, payload, 0xFF padding) into @p dst.
+ *
+ * @return Bytes written (tlog_rec_size(len)), or 0 if @p cap is too small or
+ *         @p len exceeds TLOG_REC_MAX_LEN.
+ */
+size_t tlog_rec_encode(uint8_t *dst, size_t cap, uint32_t seq, const void *data, uint16_t len);
+
+/** True if every byte of @p hdr is erased (0xFF): end of the sector's records. */
+bool tlog_rec_hdr_erased(const struct tlog_rec_hdr *hdr);
+
+/** True if @p hdr has the record magic and a plausible length. */
+bool tlog_rec_hdr_plausible(const struct tlog_rec_hdr *hdr);
+
+/** True if the CRC in @p hdr matches it and @p payload (hdr->len bytes). */
+bool tlog_rec_crc_ok(const struct tlog_rec_hdr *hdr, const void *payload);
+
+/** Index of the newest sector (highest gen), or -1 if all are erased. */
+int tlog_index_newest(const struct tlog_index_entry *idx, size_t n);
+
+/** Index of the oldest sector (lowest nonzero gen), or -1 if all are erased. */
+int tlog_index_oldest(const struct tlog_index_entry *idx, size_t n);
+
+/**
+ * @brief Sector holding record @p seq: the newest sector whose first_seq is
+ *        not after @p seq.
+ *
+ * Sectors are walked as a ring from the oldest, so this is a binary search
+ * over at most @p n entries.
+ *
+ * @return Sector index, or -1 if @p seq is older than the oldest sector or
+ *         no sector is written.
+ */
+int tlog_index_find(const struct tlog_index_entry *idx, size_t n, uint32_t seq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_TLOG_FORMAT_H_ */
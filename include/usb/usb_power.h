@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFMODULE_USB_POWER_H_
+#define NRFMODULE_USB_POWER_H_
+
+/**
+ * @file usb_power.h
+ * @brief USB VBUS power manager.
+ *
+ * Started at boot when the board's devicetree has an nrfmodule,usb-power
+ * node. Each VBUS edge (re)starts a debounce; when VBUS has held its level
+ * for debounce-ms, USBD is enabled or disabled and logging is moved to or
+ * from the USB log backend. Boards need no code of their own.
+ */
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** True while a settled VBUS attach has USBD enabled. */
+bool usb_power_attached(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFMODULE_USB_POWER_H_ */
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pure pressure altitude + alpha-beta vertical-speed filter.
+ */
+
+#include <baro/baro_alt.h>
+
+#include <errno.h>
+#include <stddef.h>
+
+/* Table domain: pressure ratio 0.25..1.25 in Q24, 256 segments of 1/256. */
+#define RATIO_SHIFT   24
+#define RATIO_LO      (1U << (RATIO_SHIFT - 2))
+#define RATIO_HI      (RATIO_LO + (1U << RATIO_SHIFT))
+#define SEG_SHIFT     (RATIO_SHIFT - 8)
+#define SEG_FRAC_MASK ((1U << SEG_SHIFT) - 1)
+
+#define Q16_ONE       (65536)
+#define Q24_ONE       (INT64_C(1) << 24)
+
+/* Kalata's tracking index: alpha > 0.9996 beyond this, and lambda^2 in Q24
+ * still fits 64 bits.
+ */
+#define LAMBDA_MAX     (100)
+#define LAMBDA_MAX_Q24 ((uint64_t)LAMBDA_MAX << 24)
+
+/*
+ * Altitude in mm at ratio 0.25 + i / 256, i = 0..256:
+ *   round(44330.77 * (1 - r^0.190263) * 1000)
+ */
+static const int32_t alt_table_mm[257] = {
+	10277758, 10177157, 10077803, 9979659, 9882695, 9786879, 9692180, 9598571,
+	9506023, 9414511, 9324007, 9234489, 9145932, 9058314, 8971612, 8885806,
+	8800875, 8716799, 8633560, 8551138, 8469517, 8388678, 8308606, 8229285,
+	8150698, 8072832, 7995670, 7919200, 7843407, 7768278, 7693801, 7619962,
+	7546750, 7474153, 7402160, 7330759, 7259940, 7189691, 7120004, 7050868,
+	6982273, 6914210, 6846670, 6779644, 6713124, 6647100, 6581565, 6516511,
+	6451929, 6387813, 6324154, 6260946, 6198182, 6135854, 6073956, 6012481,
+	5951423, 5890776, 5830534, 5770690, 5711238, 5652174, 5593491, 5535184,
+	5477247, 5419676, 5362465, 5305609, 5249104, 5192944, 5137125, 5081642,
+	5026492, 4971668, 4917168, 4862986, 4809120, 4755563, 4702314, 4649367,
+	4596720, 4544367, 4492306, 4440533, 4389045, 4337837, 4286907, 4236251,
+	4185866, 4135749, 4085896, 4036305, 3986972, 3937895, 3889070, 3840494,
+	3792165, 3744081, 3696237, 3648632, 3601263, 3554128, 3507223, 3460546,
+	3414095, 3367867, 3321861, 3276073, 3230501, 3185143, 3139998, 3095061,
+	3050333, 3005809, 2961489, 2917370, 2873450, 2829727, 2786199, 2742865,
+	2699722, 2656768, 2614002, 2571422, 2529025, 2486811, 2444777, 2402923,
+	2361245, 2319742, 2278414, 2237257, 2196271, 2155454, 2114805, 2074321,
+	2034002, 1993846, 1953851, 1914016, 1874339, 1834820, 1795457, 1756248,
+	1717192, 1678288, 1639534, 1600930, 1562473, 1524163, 1485999, 1447978,
+	1410100, 1372365, 1334769, 1297313, 1259996, 1222815, 1185770, 1148861,
+	1112085, 1075441, 1038930, 1002549, 966297, 930174, 894179, 858310,
+	822566, 786947, 751452, 716079, 680828, 645698, 610687, 575796,
+	541022, 506366, 471825, 437401, 403090, 368894, 334810, 300838,
+	266977, 233227, 199587, 166055, 132631, 99314, 66104, 33000,
+	0, -32895, -65687, -98376, -130963, -163449, -195834, -228119,
+	-260305, -292392, -324382, -356274, -388069, -419769, -451374, -482883,
+	-514299, -545621, -576851, -607989, -639034, -669989, -700854, -731629,
+	-762314, -792911, -823420, -853842, -884177, -914425, -944587, -974664,
+	-1004657, -1034565, -1064389, -1094131, -1123789, -1153366, -1182861, -1212275,
+	-1241608, -1270861, -1300034, -1329128, -1358144, -1387081, -1415941, -1444723,
+	-1473429, -1502058, -1530611, -1559089, -1587492, -1615820, -1644074, -1672254,
+	-1700361, -1728396, -1756357, -1784247, -1812065, -1839812, -1867489, -1895094,
+	-1922630,
+};
+
+int32_t baro_alt_mm(uint32_t press_cpa, uint32_t p0_cpa)
+{
+	uint64_t ratio;
+	uint32_t x;
+	int32_t a;
+	int32_t b;
+
+	if (p0_cpa == 0) {
+		return 0;
+	}
+
+	ratio = ((uint64_t)press_cpa << RATIO_SHIFT) / p0_cpa;
+	if (ratio < RATIO_LO) {
+		ratio = RATIO_LO;
+	} else if (ratio >= RATIO_HI) {
+		ratio = RATIO_HI - 1;
+	}
+
+	x = (uint32_t)ratio - RATIO_LO;
+	a = alt_table_mm[x >> SEG_SHIFT];
+	b = alt_table_mm[(x >> SEG_SHIFT) + 1];
+
+	return a + (int32_t)(((int64_t)(b - a) * (x & SEG_FRAC_MASK)) >> SEG_SHIFT);
+}
+
+static uint64_t isqrt64(uint64_t v)
+{
+	uint64_t root = 0;
+	uint64_t bit = (uint64_t)1 << 62;
+
+	while (bit > v) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (v >= root + bit) {
+			v -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+int baro_alt_filter_gains(struct baro_alt_filter_cfg *cfg, uint32_t meas_noise_mm,
+			  uint32_t accel_noise_mm_s2, uint32_t dt_ms)
+{
+	uint64_t num = (uint64_t)accel_noise_mm_s2 * dt_ms * dt_ms;
+	uint64_t den = (uint64_t)meas_noise_mm * 1000000U;
+	uint64_t lambda;
+	uint64_t s;
+	int64_t r;
+
+	if (meas_noise_mm == 0 || dt_ms == 0) {
+		return -EINVAL;
+	}
+
+	/* lambda = sigma_a * dt^2 / sigma_z, dt in s; Q24 so that small
+	 * indices (slow samples, quiet sensor) keep their precision.
+	 */
+	if (num / den >= LAMBDA_MAX) {
+		lambda = LAMBDA_MAX_Q24;
+	} else {
+		/* Keep num << 24 in range; den stays > num / LAMBDA_MAX. */
+		while (num >= (UINT64_C(1) << 39)) {
+			num >>= 1;
+			den >>= 1;
+		}
+		lambda = (num << 24) / den;
+	}
+
+	/* r = (4 + lambda - sqrt(8 lambda + lambda^2)) / 4 */
+	s = isqrt64((8 * lambda + ((lambda * lambda) >> 24)) << 24);
+	r = ((int64_t)(4 * Q24_ONE) + (int64_t)lambda - (int64_t)s) / 4;
+
+	/* alpha = 1 - r^2, beta = 2 (1 - r)^2, back to Q16 */
+	cfg->alpha = (uint32_t)((Q24_ONE - ((r * r) >> 24)) >> 8);
+	cfg->beta = (uint32_t)(((2 * (Q24_ONE - r) * (Q24_ONE - r)) >> 24) >> 8);
+
+	return 0;
+}
+
+void baro_alt_filter_init(struct baro_alt_filter *f, const struct baro_alt_filter_cfg *cfg)
+{
+	f->cfg = *cfg;
+	f->alt_um = 0;
+	f->vs_um_s = 0;
+	f->primed = false;
+}
+
+void baro_alt_filter_update(struct baro_alt_filter *f, int32_t alt_mm,
+			    int32_t accel_mm_s2, uint32_t dt_ms)
+{
+	const int64_t z = (int64_t)alt_mm * 1000;
+	const int64_t a = (int64_t)accel_mm_s2 * 1000;
+	const int64_t dt = dt_ms;
+	int64_t resid;
+
+	if (!f->primed) {
+		f->alt_um = z;
+		f->vs_um_s = 0;
+		f->primed = true;
+		return;
+	}
+	if (dt_ms == 0) {
+		return;
+	}
+
+	/* Predict: constant acceleration over dt (zero without an accelerometer). */
+	f->alt_um += f->vs_um_s * dt / 1000 + a * dt * dt / 2000000;
+	f->vs_um_s += a * dt / 1000;
+
+	/* Correct from the barometric residual. */
+	resid = z - f->alt_um;
+	f->alt_um += resid * (int64_t)f->cfg.alpha / Q16_ONE;
+	f->vs_um_s += resid * (int64_t)f->cfg.beta / Q16_ONE * 1000 / dt;
+}
+
+int32_t baro_alt_filter_alt_mm(const struct baro_alt_filter *f)
+{
+	return (int32_t)(f->alt_um / 1000);
+}
+
+int32_t baro_alt_filter_vspeed_mm_s(const struct baro_alt_filter *f)
+{
+	return (int32_t)(f->vs_um_s / 1000);
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Defaults for the BLE log backend's queue API (nrfmodule_ble_log_backend.h)
+ * until the nrfmodule-core backend runs its messages through ble_log_ring.
+ * A backend that does overrides them with its own definitions.
+ */
+
+#include <nrfmodule_ble_log_backend.h>
+
+#include <errno.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+__weak void nrfmodule_ble_log_set_congestion_hook(nrfmodule_ble_log_congestion_hook_t hook,
+						   void *ctx)
+{
+	/* No queue to congest: the hook would never be called. */
+	ARG_UNUSED(hook);
+	ARG_UNUSED(ctx);
+}
+
+__weak int nrfmodule_ble_log_get_stats(struct nrfmodule_ble_log_stats *stats)
+{
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+}
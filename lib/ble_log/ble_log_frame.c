@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pure BLE log notification packer.
+ */
+
+#include <ble_log/ble_log_frame.h>
+#include <ble_log/ble_log_lz.h>
+
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+static void open_frame(struct ble_log_packer *p)
+{
+	p->frame[0] = BLE_LOG_FRAME_FLAGS(p->flags | ((p->lz != NULL) ? BLE_LOG_FRAME_F_LZ : 0));
+	p->frame[1] = BLE_LOG_FRAME_NO_START;
+	sys_put_le16(p->seq, &p->frame[2]);
+	p->len = BLE_LOG_FRAME_HDR_SIZE;
+	if (p->lz != NULL) {
+		ble_log_lz_reset(p->lz);
+	}
+}
+
+void ble_log_packer_init(struct ble_log_packer *p, ble_log_emit_t emit, void *ctx)
+{
+	p->len = 0;
+	p->cap = BLE_LOG_FRAME_MIN;
+	p->seq = 0;
+	p->flags = 0;
+	p->dropped = 0;
+	p->lz = NULL;
+	p->emit = emit;
+	p->ctx = ctx;
+}
+
+void ble_log_packer_set_mtu(struct ble_log_packer *p, uint16_t att_mtu)
+{
+	p->cap = CLAMP(att_mtu - 3, BLE_LOG_FRAME_MIN, BLE_LOG_FRAME_MAX);
+	if (p->len >= p->cap) {
+		(void)ble_log_packer_flush(p);
+	}
+}
+
+void ble_log_packer_set_flags(struct ble_log_packer *p, uint8_t flags)
+{
+	if (flags != p->flags) {
+		(void)ble_log_packer_flush(p);
+		p->flags = flags;
+	}
+}
+
+void ble_log_packer_set_lz(struct ble_log_packer *p, struct ble_log_lz *lz)
+{
+	(void)ble_log_packer_flush(p);
+	p->lz = lz;
+}
+
+int ble_log_packer_flush(struct ble_log_packer *p)
+{
+	int err;
+
+	if (p->len == 0) {
+		return 0;
+	}
+
+	err = p->emit(p->frame, p->len, p->ctx);
+	if (err) {
+		p->dropped++;
+	}
+	/* A dropped frame still uses its seq, so the host sees the gap. */
+	p->seq++;
+	p->len = 0;
+
+	return err;
+}
+
+/* Compressed size is only known by trying: a message that does not fit the
+ * rest of the open frame is compressed again into a fresh one, and split
+ * only if it does not fit that either. */
+static void put_lz(struct ble_log_packer *p, const uint8_t *msg, size_t len)
+{
+	bool start = true;
+
+	while (len > 0) {
+		bool fresh;
+		size_t used;
+		size_t n;
+
+		if (p->len == 0) {
+			open_frame(p);
+		}
+		fresh = (p->len == BLE_LOG_FRAME_HDR_SIZE);
+
+		n = ble_log_lz_compress(p->lz, msg, len, &p->frame[p->len], p->cap - p->len, &used);
+		if (used < len && start && !fresh) {
+			(void)ble_log_packer_flush(p);
+			continue;
+		}
+
+		if (start && p->frame[1] == BLE_LOG_FRAME_NO_START) {
+			p->frame[1] = (uint8_t)(p->len - BLE_LOG_FRAME_HDR_SIZE);
+		}
+		start = false;
+		p->len += n;
+		msg += used;
+		len -= used;
+
+		if (len > 0 || p->len == p->cap) {
+			(void)ble_log_packer_flush(p);
+		}
+	}
+}
+
+void ble_log_packer_put(struct ble_log_packer *p, const uint8_t *msg, size_t len)
+{
+	bool start = true;
+
+	if (p->lz != NULL) {
+		put_lz(p, msg, len);
+		return;
+	}
+
+	/* Rather than split a message that fits a frame of its own, send the
+	 * open frame short: each frame then stays decodable on its own. */
+	if (p->len != 0 && p->len + len > p->cap &&
+	    BLE_LOG_FRAME_HDR_SIZE + len <= p->cap) {
+		(void)ble_log_packer_flush(p);
+	}
+
+	while (len > 0) {
+		size_t n;
+
+		if (p->len == 0) {
+			open_frame(p);
+		}
+		if (start && p->frame[1] == BLE_LOG_FRAME_NO_START) {
+			p->frame[1] = (uint8_t)(p->len - BLE_LOG_FRAME_HDR_SIZE);
+		}
+		start = false;
+
+		n = MIN(len, (size_t)(p->cap - p->len));
+		memcpy(&p->frame[p->len], msg, n);
+		p->len += n;
+		msg += n;
+		len -= n;
+
+		if (p->len == p->cap) {
+			(void)ble_log_packer_flush(p);
+		}
+	}
+}
+
+void ble_log_packer_put_drops(struct ble_log_packer *p, const uint8_t *report, size_t len)
+{
+	const uint8_t flags = p->flags;
+
+	ble_log_packer_set_flags(p, flags | BLE_LOG_FRAME_F_DROPS);
+	ble_log_packer_put(p, report, len);
+	ble_log_packer_set_flags(p, flags);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * BLE log link tuning: ATT MTU, data length and PHY requests on subscribe.
+ */
+
+#include <ble_log/ble_log_link.h>
+
+#include <errno.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+
+LOG_MODULE_REGISTER(nrfmodule_ble_log_link, LOG_LEVEL_INF);
+
+#if defined(CONFIG_BT_GATT_CLIENT)
+/* Held by the stack until mtu_done(); one exchange in flight at a time. */
+static struct bt_gatt_exchange_params mtu_params;
+static atomic_t mtu_busy;
+
+static void mtu_done(struct bt_conn *conn, uint8_t err, struct bt_gatt_exchange_params *params)
+{
+	ARG_UNUSED(params);
+
+	LOG_DBG("ATT MTU %u (err %u)", bt_gatt_get_mtu(conn), err);
+	atomic_clear(&mtu_busy);
+}
+#endif
+
+static inline void keep_first(int *ret, int err)
+{
+	if (*ret == 0) {
+		*ret = err;
+	}
+}
+
+int ble_log_link_tune(struct bt_conn *conn)
+{
+	int ret = 0;
+
+#if defined(CONFIG_BT_GATT_CLIENT)
+	if (atomic_cas(&mtu_busy, 0, 1)) {
+		int err;
+
+		mtu_params.func = mtu_done;
+		err = bt_gatt_exchange_mtu(conn, &mtu_params);
+		if (err) {
+			atomic_clear(&mtu_busy);
+			/* -EALREADY: exchanged earlier on this link. */
+			keep_first(&ret, (err == -EALREADY) ? 0 : err);
+		}
+	}
+#endif
+
+#if defined(CONFIG_BT_USER_DATA_LEN_UPDATE)
+	keep_first(&ret, bt_conn_le_data_len_update(conn, BT_LE_DATA_LEN_PARAM_MAX));
+#endif
+
+#if defined(CONFIG_BT_USER_PHY_UPDATE)
+	keep_first(&ret, bt_conn_le_phy_update(conn, BT_CONN_LE_PHY_PARAM_2M));
+#endif
+
+	if (ret) {
+		LOG_WRN("link tuning: %d", ret);
+	}
+
+	return ret;
+}
+
+static void tune_one(struct bt_conn *conn, void *data)
+{
+	ARG_UNUSED(data);
+
+	(void)ble_log_link_tune(conn);
+}
+
+void ble_log_link_tune_all(void)
+{
+	bt_conn_foreach(BT_CONN_TYPE_LE, tune_one, NULL);
+}
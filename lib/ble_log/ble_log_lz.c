@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pure per-frame LZ77 for BLE log frames. Greedy parse with short hash
+ * chains: the history is at most one frame's worth of text, so a few
+ * candidates per position find nearly every match.
+ */
+
+#include <ble_log/ble_log_lz.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#define CHAIN_DEPTH  (8)
+#define LIT_RUN_MAX  (128)
+#define MATCH_FLAG   (0x80)
+
+/* Level prefixes of Zephyr's text log output, nearest (most likely) last. */
+const uint8_t ble_log_lz_dict[] =
+	": 0x00000000\r\n"
+	"[00:00:00.000,000] <err> "
+	"[00:00:00.000,000] <wrn> "
+	"[00:00:00.000,000] <dbg> "
+	"[00:00:00.000,000] <inf> ";
+const size_t ble_log_lz_dict_len = sizeof(ble_log_lz_dict) - 1;
+
+BUILD_ASSERT(sizeof(ble_log_lz_dict) - 1 < BLE_LOG_LZ_WINDOW / 4,
+	     "leave the window to the frame");
+
+static uint16_t hash3(const uint8_t *p)
+{
+	const uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+
+	return (uint16_t)((v * 2654435761U) >> (32 - BLE_LOG_LZ_HASH_BITS));
+}
+
+/* @p pos needs its next two bytes in hist already. */
+static void insert(struct ble_log_lz *lz, uint16_t pos)
+{
+	const uint16_t h = hash3(&lz->hist[pos]);
+
+	lz->prev[pos] = lz->head[h];
+	lz->head[h] = pos + 1;
+}
+
+void ble_log_lz_reset(struct ble_log_lz *lz)
+{
+	memset(lz->head, 0, sizeof(lz->head));
+	memcpy(lz->hist, ble_log_lz_dict, ble_log_lz_dict_len);
+	lz->hist_len = ble_log_lz_dict_len;
+	for (uint16_t i = 0; i + BLE_LOG_LZ_MIN_MATCH <= lz->hist_len; i++) {
+		insert(lz, i);
+	}
+}
+
+static size_t longest_match(const struct ble_log_lz *lz, uint16_t pos, uint16_t end,
+			    uint16_t *offset)
+{
+	const size_t limit = MIN((size_t)(end - pos), (size_t)BLE_LOG_LZ_MAX_MATCH);
+	uint16_t cand = lz->head[hash3(&lz->hist[pos])];
+	size_t best = 0;
+
+	for (int depth = 0; cand != 0 && depth < CHAIN_DEPTH; depth++) {
+		const uint16_t c = cand - 1;
+		size_t n = 0;
+
+		/* Overlap is fine: c + n < pos + n <= end. */
+		while (n < limit && lz->hist[c + n] == lz->hist[pos + n]) {
+			n++;
+		}
+		if (n > best) {
+			best = n;
+			*offset = pos - c;
+			if (n == limit) {
+				break;
+			}
+		}
+		cand = lz->prev[c];
+	}
+
+	return best;
+}
+
+size_t ble_log_lz_compress(struct ble_log_lz *lz, const uint8_t *src, size_t len,
+			   uint8_t *dst, size_t cap, size_t *consumed)
+{
+	const uint16_t base = lz->hist_len;
+	const uint16_t end = base + MIN(len, (size_t)(BLE_LOG_LZ_WINDOW - base));
+	uint16_t pos = base;
+	size_t out = 0;
+	size_t run = 0; /* dst index of the open literal run's token */
+	bool in_run = false;
+
+	/* The whole input goes into the history first, so matches can look
+	 * ahead into it; what is not consumed is cut off again below. */
+	memcpy(&lz->hist[base], src, end - base);
+
+	while (pos < end) {
+		uint16_t offset = 0;
+		const size_t n = (pos + BLE_LOG_LZ_MIN_MATCH <= end) ?
+				 longest_match(lz, pos, end, &offset) : 0;
+
+		if (n >= BLE_LOG_LZ_MIN_MATCH) {
+			if (out + 2 > cap) {
+				break;
+			}
+			dst[out++] = MATCH_FLAG | ((n - BLE_LOG_LZ_MIN_MATCH) << 2) |
+				     ((offset - 1) >> 8);
+			dst[out++] = (uint8_t)(offset - 1);
+			in_run = false;
+			for (size_t i = 0; i < n; i++, pos++) {
+				if (pos + BLE_LOG_LZ_MIN_MATCH <= end) {
+					insert(lz, pos);
+				}
+			}
+			continue;
+		}
+
+		if (!in_run || dst[run] == LIT_RUN_MAX - 1) {
+			if (out + 2 > cap) {
+				break;
+			}
+			run = out;
+			dst[out++] = 0;
+			in_run = true;
+		} else if (out + 1 > cap) {
+			break;
+		} else {
+			dst[run]++;
+		}
+		dst[out++] = lz->hist[pos];
+		if (pos + BLE_LOG_LZ_MIN_MATCH <= end) {
+			insert(lz, pos);
+		}
+		pos++;
+	}
+
+	lz->hist_len = pos;
+	*consumed = pos - base;
+
+	return out;
+}
+
+int ble_log_lz_decode(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+	const size_t dict_len = ble_log_lz_dict_len;
+	size_t in = 0;
+	size_t out = 0;
+
+	while (in < len) {
+		const uint8_t token = src[in++];
+
+		if (!(token & MATCH_FLAG)) {
+			const size_t n = (size_t)token + 1;
+
+			if (in + n > len) {
+				return -EBADMSG;
+			}
+			if (out + n > cap) {
+				return -ENOBUFS;
+			}
+			memcpy(&dst[out], &src[in], n);
+			in += n;
+			out += n;
+			continue;
+		}
+
+		if (in == len) {
+			return -EBADMSG;
+		}
+
+		const size_t n = ((token >> 2) & 0x1F) + BLE_LOG_LZ_MIN_MATCH;
+		const size_t offset = ((((size_t)token & 0x03) << 8) | src[in++]) + 1;
+
+		if (offset > dict_len + out) {
+			return -EBADMSG;
+		}
+		if (out + n > cap) {
+			return -ENOBUFS;
+		}
+		/* Byte by byte: the copy may overlap its own output, or start in
+		 * the primed window. */
+		for (size_t i = 0; i < n; i++, out++) {
+			const size_t from = dict_len + out - offset;
+
+			dst[out] = (from < dict_len) ? ble_log_lz_dict[from] : dst[from - dict_len];
+		}
+	}
+
+	return (int)out;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pure SPSC message ring with level shedding. head and tail run free and
+ * are masked on access; each side publishes its own index with atomic_set()
+ * after the bytes it covers are written or read. A record that would
+ * straddle the end is preceded by a padding record to the end instead.
+ */
+
+#include <ble_log/ble_log_ring.h>
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+/* Record: u16 length, u8 level, u8 reserved, data padded to 4. */
+#define REC_HDR_SIZE (4U)
+#define REC_PAD      (0xFFFFU)
+
+static uint32_t rec_size(size_t len)
+{
+	return REC_HDR_SIZE + ROUND_UP(len, 4U);
+}
+
+void ble_log_ring_init(struct ble_log_ring *r, uint8_t *buf, uint32_t size,
+		       uint8_t high_pct, uint8_t low_pct)
+{
+	r->buf = buf;
+	r->size = size;
+	r->high = (uint32_t)((uint64_t)size * high_pct / 100U);
+	r->low = (uint32_t)((uint64_t)size * low_pct / 100U);
+	atomic_set(&r->head, 0);
+	atomic_set(&r->tail, 0);
+	r->congested = false;
+	memset(r->shed, 0, sizeof(r->shed));
+	memset(r->dropped, 0, sizeof(r->dropped));
+	r->peak = 0;
+}
+
+uint32_t ble_log_ring_used(struct ble_log_ring *r)
+{
+	return (uint32_t)atomic_get(&r->head) - (uint32_t)atomic_get(&r->tail);
+}
+
+/* Highest level still accepted: the fill between the high watermark and
+ * full is split in thirds that shed DBG, then INF, then WRN. */
+static uint8_t accepted_level(const struct ble_log_ring *r, uint32_t used)
+{
+	const uint32_t span = r->size - r->high;
+	const uint32_t over = used - r->high;
+
+	if (!r->congested) {
+		return BLE_LOG_RING_LEVELS;
+	}
+	if (used < r->high || over < span / 3) {
+		return 3; /* INF */
+	}
+	if (over < 2 * span / 3) {
+		return 2; /* WRN */
+	}
+
+	return 1; /* ERR */
+}
+
+static bool push(struct ble_log_ring *r, uint8_t level, const void *a, size_t a_len)
+{
+	uint32_t head = (uint32_t)atomic_get(&r->head);
+	const uint32_t used = head - (uint32_t)atomic_get(&r->tail);
+	const uint32_t need = rec_size(a_len);
+	const uint32_t contig = r->size - (head & (r->size - 1));
+	const uint32_t total = (contig < need) ? contig + need : need;
+	uint8_t *rec;
+
+	if (used + total > r->size) {
+		return false;
+	}
+
+	if (contig < need) {
+		sys_put_le16(REC_PAD, &r->buf[head & (r->size - 1)]);
+		head += contig;
+	}
+
+	rec = &r->buf[head & (r->size - 1)];
+	sys_put_le16((uint16_t)a_len, &rec[0]);
+	rec[2] = level;
+	rec[3] = 0;
+	memcpy(&rec[REC_HDR_SIZE], a, a_len);
+	head += need;
+
+	atomic_set(&r->head, (atomic_val_t)head);
+	r->peak = MAX(r->peak, used + total);
+
+	return true;
+}
+
+static void queue_drops(struct ble_log_ring *r)
+{
+	uint8_t report[BLE_LOG_RING_DROPS_SIZE];
+	uint32_t total = 0;
+
+	for (int i = 0; i < BLE_LOG_RING_LEVELS; i++) {
+		sys_put_le32(r->shed[i], &report[4 * i]);
+		total += r->shed[i];
+	}
+	if (total != 0 && push(r, BLE_LOG_RING_DROPS, report, sizeof(report))) {
+		memset(r->shed, 0, sizeof(r->shed));
+	}
+}
+
+int ble_log_ring_put(struct ble_log_ring *r, uint8_t level, const void *msg, size_t len)
+{
+	const uint32_t used = ble_log_ring_used(r);
+	const uint8_t idx = CLAMP(level, 1, BLE_LOG_RING_LEVELS) - 1;
+
+	if (used >= r->high) {
+		r->congested = true;
+	} else if (r->congested && used <= r->low) {
+		r->congested = false;
+	}
+	if (!r->congested) {
+		queue_drops(r);
+	}
+
+	if (rec_size(len) > r->size || len >= REC_PAD) {
+		r->dropped[idx]++;
+		r->shed[idx]++;
+		return -EMSGSIZE;
+	}
+	if (idx + 1 > accepted_level(r, used) || !push(r, idx + 1, msg, len)) {
+		r->dropped[idx]++;
+		r->shed[idx]++;
+		return -ENOSPC;
+	}
+
+	return 0;
+}
+
+int ble_log_ring_get(struct ble_log_ring *r, uint8_t *level, void *dst, size_t cap)
+{
+	const uint32_t head = (uint32_t)atomic_get(&r->head);
+	uint32_t tail = (uint32_t)atomic_get(&r->tail);
+	const uint8_t *rec;
+	uint16_t len;
+
+	if (tail == head) {
+		return -EAGAIN;
+	}
+
+	rec = &r->buf[tail & (r->size - 1)];
+	len = sys_get_le16(rec);
+	if (len == REC_PAD) {
+		tail += r->size - (tail & (r->size - 1));
+		rec = &r->buf[tail & (r->size - 1)];
+		len = sys_get_le16(rec);
+	}
+
+	*level = rec[2];
+	if (len <= cap) {
+		memcpy(dst, &rec[REC_HDR_SIZE], len);
+	}
+	tail += rec_size(len);
+	atomic_set(&r->tail, (atomic_val_t)tail);
+
+	return (len <= cap) ? (int)len : -ENOBUFS;
+}
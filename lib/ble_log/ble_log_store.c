@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Offline BLE log store: a tlog of formatted messages, replayed through the
+ * notification packer with record seqs. No logging here, and the tlog is
+ * quiet: this runs inside the log backend.
+ */
+
+#include <ble_log/ble_log_store.h>
+#include <ble_log/ble_log_frame.h>
+#include <storage/tlog.h>
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+
+BUILD_ASSERT(CONFIG_NRFMODULE_BLE_LOG_STORE_MSG_MAX <= TLOG_REC_MAX_LEN,
+	     "a stored message is one tlog record");
+
+static struct tlog store;
+static bool mounted;
+/* Seq of the next record to replay. The replay point survives a reboot as
+ * a mark: an empty record, replayed like any other, meaning everything up
+ * to it went out. */
+static uint32_t replay_seq;
+static bool have_mark;
+static uint32_t mark_seq;
+static uint8_t rec[BLE_LOG_STORED_HDR_SIZE + CONFIG_NRFMODULE_BLE_LOG_STORE_MSG_MAX];
+
+static void flush_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(flush_work, flush_fn);
+
+static void flush_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)tlog_flush(&store);
+}
+
+/* Replay resumes after the newest mark. One in-order pass over the log. */
+static void find_mark(void)
+{
+	const uint32_t end = tlog_next_seq(&store);
+
+	replay_seq = tlog_oldest_seq(&store);
+	have_mark = false;
+	for (uint32_t seq = replay_seq; seq != end; seq++) {
+		if (tlog_read(&store, seq, rec, sizeof(rec)) == 0) {
+			replay_seq = seq + 1;
+			mark_seq = seq;
+			have_mark = true;
+		}
+	}
+}
+
+/* Caught up: append a mark, unless the newest record already is one.
+ * True if it did. */
+static bool put_mark(void)
+{
+	const uint32_t end = tlog_next_seq(&store);
+
+	if (end == tlog_oldest_seq(&store) || (have_mark && mark_seq + 1 == end)) {
+		return false;
+	}
+	if (tlog_append(&store, rec, 0) != 0) {
+		return false;
+	}
+	mark_seq = end;
+	have_mark = true;
+	(void)k_work_schedule(&flush_work, K_SECONDS(CONFIG_NRFMODULE_BLE_LOG_STORE_FLUSH_S));
+
+	return true;
+}
+
+int ble_log_store_init(uint8_t area_id)
+{
+	int err;
+
+	store.quiet = true;
+	err = tlog_init(&store, area_id);
+	if (err) {
+		return err;
+	}
+	find_mark();
+	mounted = true;
+
+	return 0;
+}
+
+int ble_log_store_put(const void *msg, uint16_t len)
+{
+	int err;
+
+	if (!mounted) {
+		return -ENODEV;
+	}
+	if (len == 0) {
+		return -EINVAL;
+	}
+	if (len > CONFIG_NRFMODULE_BLE_LOG_STORE_MSG_MAX) {
+		return -EMSGSIZE;
+	}
+
+	err = tlog_append(&store, msg, len);
+	if (err) {
+		return err;
+	}
+	/* First record of a batch starts the clock; later ones ride on it. */
+	(void)k_work_schedule(&flush_work, K_SECONDS(CONFIG_NRFMODULE_BLE_LOG_STORE_FLUSH_S));
+
+	return 0;
+}
+
+int ble_log_store_replay(struct ble_log_packer *p, size_t max_records)
+{
+	uint32_t dropped;
+	uint32_t end;
+	/* First record with bytes in the packer's open frame. */
+	uint32_t frame_first;
+	int ret = 0;
+
+	if (!mounted) {
+		return 0;
+	}
+
+	end = tlog_next_seq(&store);
+	/* Wrap-around may have dropped records since the last replay. */
+	replay_seq = MAX(replay_seq, tlog_oldest_seq(&store));
+
+	ble_log_packer_set_flags(p, BLE_LOG_FRAME_F_STORED);
+	dropped = p->dropped;
+	frame_first = replay_seq;
+
+	while (ret == 0 && p->dropped == dropped) {
+		uint32_t seq;
+		uint16_t frame_seq;
+		int len;
+
+		if (replay_seq == end) {
+			/* Caught up. The mark goes out too, so the host sees
+			 * every seq. */
+			if (!put_mark()) {
+				break;
+			}
+			end++;
+		}
+		if (max_records == 0) {
+			break;
+		}
+
+		seq = replay_seq;
+		frame_seq = p->seq;
+		len = tlog_read(&store, seq, &rec[BLE_LOG_STORED_HDR_SIZE],
+				sizeof(rec) - BLE_LOG_STORED_HDR_SIZE);
+		if (len == -EIO) {
+			ret = -EIO;
+			break;
+		}
+		replay_seq++;
+		if (len < 0) {
+			/* Lost or corrupt: the host sees the missing seq. */
+			continue;
+		}
+
+		if (p->len == 0) {
+			frame_first = seq;
+		}
+		sys_put_le32(seq, &rec[0]);
+		sys_put_le16((uint16_t)len, &rec[4]);
+		ble_log_packer_put(p, rec, BLE_LOG_STORED_HDR_SIZE + len);
+		if (p->dropped != dropped) {
+			break;
+		}
+		if (p->seq != frame_seq) {
+			/* Frames went out; what is left open starts with this one. */
+			frame_first = seq;
+		}
+		max_records--;
+	}
+	if (p->dropped != dropped) {
+		/* Records packed after the refused frame go out again with it. */
+		p->len = 0;
+	}
+	ble_log_packer_set_flags(p, 0);
+
+	if (p->dropped != dropped) {
+		/* Send the refused frame's records again next time; the host
+		 * skips seqs it already has from the frames that did go out. */
+		replay_seq = frame_first;
+		ret = -EAGAIN;
+	}
+
+	return (ret != 0) ? ret : (int)MIN(end - replay_seq, INT32_MAX);
+}
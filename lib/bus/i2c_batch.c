@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Batched I2C register reads: one runtime-PM hold of the bus per cycle.
+ */
+
+#include <bus/i2c_batch.h>
+
+#include <errno.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/pm/device_runtime.h>
+
+void i2c_batch_init(struct i2c_batch *batch, const struct device *bus)
+{
+	batch->bus = bus;
+	sys_slist_init(&batch->reads);
+	sys_slist_init(&batch->running);
+	k_mutex_init(&batch->lock);
+}
+
+int i2c_batch_add(struct i2c_batch *batch, struct i2c_batch_read *rd)
+{
+	int ret = 0;
+
+	if (rd->buf == NULL || rd->len == 0) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+	if (sys_slist_find(&batch->running, &rd->node, NULL)) {
+		/* Its node still links the run's walk. */
+		ret = -EBUSY;
+	} else if (sys_slist_find(&batch->reads, &rd->node, NULL)) {
+		ret = -EALREADY;
+	} else {
+		sys_slist_append(&batch->reads, &rd->node);
+	}
+	k_mutex_unlock(&batch->lock);
+
+	return ret;
+}
+
+int i2c_batch_run(struct i2c_batch *batch)
+{
+	struct i2c_batch_read *rd;
+	sys_snode_t *node;
+	int first_err = 0;
+	int ret;
+
+	/* Move the queue to the running list so adds during the run (or from
+	 * a completion) land in the next cycle. */
+	k_mutex_lock(&batch->lock, K_FOREVER);
+	if (!sys_slist_is_empty(&batch->running)) {
+		k_mutex_unlock(&batch->lock);
+		return -EBUSY;
+	}
+	batch->running = batch->reads;
+	sys_slist_init(&batch->reads);
+	k_mutex_unlock(&batch->lock);
+
+	if (sys_slist_is_empty(&batch->running)) {
+		return 0;
+	}
+
+	/* One resume for the whole list; the per-transfer get/put inside the
+	 * controller driver then only moves the usage count. Only completions
+	 * unlink nodes, so the walk needs no lock. */
+	ret = pm_device_runtime_get(batch->bus);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&batch->running, rd, node) {
+		rd->err = (ret < 0) ? ret :
+			  i2c_write_read(batch->bus, rd->addr, &rd->reg, 1, rd->buf, rd->len);
+		if (rd->err < 0 && first_err == 0) {
+			first_err = rd->err;
+		}
+	}
+
+	if (ret >= 0) {
+		(void)pm_device_runtime_put(batch->bus);
+	}
+
+	/* Each read leaves the running list before its completion, which may
+	 * then queue it again. */
+	for (;;) {
+		k_mutex_lock(&batch->lock, K_FOREVER);
+		node = sys_slist_get(&batch->running);
+		k_mutex_unlock(&batch->lock);
+		if (node == NULL) {
+			break;
+		}
+
+		rd = CONTAINER_OF(node, struct i2c_batch_read, node);
+		if (rd->done != NULL) {
+			rd->done(rd);
+		}
+	}
+
+	return first_err;
+}
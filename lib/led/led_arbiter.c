@@ -11,27 +11,84 @@
 #include <stddef.h>
 #include <string.h>
 
-/* A slot is live if set, not past its time limit, and (for a run-once effect)
- * not yet finished. Note: time-limit compare is not wrap-safe (~49-day uptime
- * edge) — acceptable for an indicator. */
+#define LED_WEIGHT_FULL (255)
+
+BUILD_ASSERT(LED_ARBITER_MAX_LAYERS <= 32, "set_mask holds one bit per layer");
+
+/* A set slot is live if not past its time limit and (for a run-once effect) not
+ * yet finished. Both ends are fixed at set time, so this is two compares — no
+ * render. Note: time-limit compare is not wrap-safe (~49-day uptime edge) —
+ * acceptable for an indicator. */
 static bool slot_live(const struct led_slot *s, uint32_t now_ms)
 {
-	if (s->effect == NULL) {
+	if (s->expire_ms != 0 && now_ms >= s->expire_ms) {
 		return false;
 	}
-	if (s->expire_ms != 0 && now_ms >= s->expire_ms) {
+	if (s->run_ms != 0 && now_ms - s->start_ms >= s->run_ms) {
 		return false;
 	}
 
-	bool done = false;
+	return true;
+}
+
+/* Highest set layer in a non-empty mask. */
+static int top_layer(uint32_t mask)
+{
+	return 31 - __builtin_clz(mask);
+}
+
+/* x / 255, rounded; exact for x <= 255 * 255. */
+static uint8_t div255(uint32_t x)
+{
+	x += 128;
+	return (uint8_t)((x + (x >> 8)) >> 8);
+}
 
-	(void)led_effect_render(s->effect, now_ms - s->start_ms, &done);
-	return !done;
+static uint8_t mix8(uint8_t below, uint8_t above, uint8_t w)
+{
+	return div255((uint32_t)below * (LED_WEIGHT_FULL - w) + (uint32_t)above * w);
+}
+
+static uint8_t blend8(enum led_blend mode, uint8_t below, uint8_t above, uint8_t w,
+		      uint8_t gain)
+{
+	switch (mode) {
+	case LED_BLEND_ALPHA:
+		return mix8(below, above, w);
+	case LED_BLEND_ADD:
+		return (uint8_t)MIN(255U, below + div255((uint32_t)above * w));
+	case LED_BLEND_MULTIPLY:
+		return mix8(below, div255((uint32_t)below * above), w);
+	case LED_BLEND_SCALE:
+		return div255((uint32_t)below * gain);
+	case LED_BLEND_REPLACE:
+	default:
+		return above;
+	}
+}
+
+static struct led_color blend(const struct led_slot *s, struct led_color below,
+			      struct led_color above)
+{
+	const enum led_blend mode = (enum led_blend)s->blend;
+	/* SCALE dims by the layer's brightness (its max channel) times weight. */
+	const uint8_t gain = div255((uint32_t)MAX(above.r, MAX(above.g, above.b)) *
+				    s->weight);
+
+	return (struct led_color){
+		.r = blend8(mode, below.r, above.r, s->weight, gain),
+		.g = blend8(mode, below.g, above.g, s->weight, gain),
+		.b = blend8(mode, below.b, above.b, s->weight, gain),
+	};
 }
 
 void led_arbiter_init(struct led_arbiter *a)
 {
 	memset(a, 0, sizeof(*a));
+	for (int l = 0; l < LED_ARBITER_MAX_LAYERS; l++) {
+		a->slots[l].blend = LED_BLEND_REPLACE;
+		a->slots[l].weight = LED_WEIGHT_FULL;
+	}
 }
 
 void led_arbiter_set(struct led_arbiter *a, uint8_t layer,
@@ -44,9 +101,20 @@ void led_arbiter_set(struct led_arbiter *a, uint8_t layer,
 		return;
 	}
 
-	a->slots[layer].effect = effect;
-	a->slots[layer].start_ms = now_ms;
-	a->slots[layer].expire_ms = (lifetime_ms == 0) ? 0 : (now_ms + lifetime_ms);
+	struct led_slot *s = &a->slots[layer];
+
+	s->effect = effect;
+	s->start_ms = now_ms;
+	s->expire_ms = (lifetime_ms == 0) ? 0 : (now_ms + lifetime_ms);
+	/* Same finish rule as led_effect_render(): a run-once effect is done once
+	 * a full pass has elapsed; a zero-length one never finishes. */
+	s->run_ms = (effect != NULL && !effect->loop) ? led_effect_duration_ms(effect) : 0;
+
+	if (effect != NULL) {
+		a->set_mask |= BIT(layer);
+	} else {
+		a->set_mask &= ~BIT(layer);
+	}
 }
 
 void led_arbiter_clear(struct led_arbiter *a, uint8_t layer)
@@ -55,12 +123,27 @@ void led_arbiter_clear(struct led_arbiter *a, uint8_t layer)
 		 LED_ARBITER_MAX_LAYERS);
 	if (layer < LED_ARBITER_MAX_LAYERS) {
 		a->slots[layer].effect = NULL;
+		a->set_mask &= ~BIT(layer);
+	}
+}
+
+void led_arbiter_set_blend(struct led_arbiter *a, uint8_t layer,
+			   enum led_blend blend, uint8_t weight)
+{
+	__ASSERT(layer < LED_ARBITER_MAX_LAYERS, "layer %u >= %d", layer,
+		 LED_ARBITER_MAX_LAYERS);
+	if (layer < LED_ARBITER_MAX_LAYERS) {
+		a->slots[layer].blend = (uint8_t)blend;
+		a->slots[layer].weight = weight;
 	}
 }
 
 int led_arbiter_active(const struct led_arbiter *a, uint32_t now_ms)
 {
-	for (int l = LED_ARBITER_MAX_LAYERS - 1; l >= 0; l--) {
+	/* Walk set layers only, top-down; normally the first one is live. */
+	for (uint32_t m = a->set_mask; m != 0U; m &= ~BIT(top_layer(m))) {
+		const int l = top_layer(m);
+
 		if (slot_live(&a->slots[l], now_ms)) {
 			return l;
 		}
@@ -71,28 +154,37 @@ int led_arbiter_active(const struct led_arbiter *a, uint32_t now_ms)
 
 struct led_color led_arbiter_render(struct led_arbiter *a, uint32_t now_ms)
 {
-	int winner = -1;
-
-	for (int l = LED_ARBITER_MAX_LAYERS - 1; l >= 0; l--) {
+	struct led_color colors[LED_ARBITER_MAX_LAYERS];
+	uint8_t stack[LED_ARBITER_MAX_LAYERS];
+	int depth = 0;
+
+	/* Top-down over set layers: render each live one once, stop at the first
+	 * opaque one. */
+	for (uint32_t m = a->set_mask; m != 0U; m &= ~BIT(top_layer(m))) {
+		const int l = top_layer(m);
 		struct led_slot *s = &a->slots[l];
 
-		if (s->effect == NULL) {
+		if (!slot_live(s, now_ms)) {
+			/* retire expired / finished transient */
+			s->effect = NULL;
+			a->set_mask &= ~BIT(l);
 			continue;
 		}
-		if (slot_live(s, now_ms)) {
-			if (winner < 0) {
-				winner = l;
-			}
-		} else {
-			s->effect = NULL; /* retire expired / finished transient */
+		colors[l] = led_effect_render(s->effect, now_ms - s->start_ms, NULL);
+		stack[depth++] = (uint8_t)l;
+		if (s->blend == LED_BLEND_REPLACE) {
+			break;
 		}
 	}
 
-	if (winner < 0) {
-		return (struct led_color){ 0, 0, 0 };
-	}
+	/* Bottom-up: fold the blended layers onto the base (or onto black). */
+	struct led_color out = { 0, 0, 0 };
 
-	const struct led_slot *w = &a->slots[winner];
+	while (depth > 0) {
+		const uint8_t l = stack[--depth];
+
+		out = blend(&a->slots[l], out, colors[l]);
+	}
 
-	return led_effect_render(w->effect, now_ms - w->start_ms, NULL);
+	return out;
 }
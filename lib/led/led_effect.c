@@ -33,6 +33,9 @@ uint32_t led_effect_duration_ms(const struct led_effect *e)
 	if (e == NULL || e->steps == NULL || e->step_count == 0) {
 		return 0;
 	}
+	if (e->step_end_ms != NULL) {
+		return e->step_end_ms[e->step_count - 1];
+	}
 
 	uint32_t total = 0;
 
@@ -43,6 +46,41 @@ uint32_t led_effect_duration_ms(const struct led_effect *e)
 	return total;
 }
 
+/* Step containing @p elapsed_ms (< total) and its start time, from the
+ * generated running sums: the first step ending after @p elapsed_ms. Empty
+ * steps end where their predecessor does, so they are never picked. */
+static uint16_t find_step(const struct led_effect *e, uint32_t elapsed_ms,
+			  uint32_t *start_ms)
+{
+	uint16_t lo = 0;
+	uint16_t hi = e->step_count - 1;
+
+	while (lo < hi) {
+		const uint16_t mid = lo + (hi - lo) / 2;
+
+		if (e->step_end_ms[mid] > elapsed_ms) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+
+	*start_ms = (lo == 0) ? 0 : e->step_end_ms[lo - 1];
+	return lo;
+}
+
+static struct led_color step_color(const struct led_effect *e, uint16_t i,
+				   uint32_t into_ms, uint32_t dur)
+{
+	if (e->steps[i].substep_count <= 1) {
+		return e->steps[i].color; /* instant / hold */
+	}
+
+	const uint16_t prev = (i == 0) ? (e->step_count - 1) : (i - 1);
+
+	return lerp_color(e->steps[prev].color, e->steps[i].color, into_ms, dur);
+}
+
 struct led_color led_effect_render(const struct led_effect *e, uint32_t elapsed_ms,
 				   bool *done)
 {
@@ -73,6 +111,13 @@ struct led_color led_effect_render(const struct led_effect *e, uint32_t elapsed_
 		}
 	}
 
+	if (e->step_end_ms != NULL) {
+		uint32_t start;
+		const uint16_t i = find_step(e, elapsed_ms, &start);
+
+		return step_color(e, i, elapsed_ms - start, e->step_end_ms[i] - start);
+	}
+
 	uint32_t acc = 0;
 
 	for (uint16_t i = 0; i < e->step_count; i++) {
@@ -83,14 +128,7 @@ struct led_color led_effect_render(const struct led_effect *e, uint32_t elapsed_
 			continue;
 		}
 		if (elapsed_ms < acc + dur) {
-			if (e->steps[i].substep_count <= 1) {
-				return e->steps[i].color; /* instant / hold */
-			}
-
-			const uint16_t prev = (i == 0) ? (e->step_count - 1) : (i - 1);
-
-			return lerp_color(e->steps[prev].color, e->steps[i].color,
-					  elapsed_ms - acc, dur);
+			return step_color(e, i, elapsed_ms - acc, dur);
 		}
 		acc += dur;
 	}
@@ -4,7 +4,9 @@
  *
  * RGB LED engine: renders a priority arbiter onto a PWM RGB LED. The tick
  * re-arms itself only while a layer is active; every mutator kicks it so a
- * freshly-set layer animates. Pure logic is in led_effect.c / led_arbiter.c.
+ * freshly-set layer animates. Ticks land on a shared RGB_LED_TICK_MS grid of
+ * the uptime clock, so standalone LEDs wake together and a group wakes once for
+ * all its members. Pure logic is in led_effect.c / led_arbiter.c.
  */
 
 #include <led/rgb_led.h>
@@ -12,6 +14,10 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/led.h>
 
+#if defined(CONFIG_NRFMODULE_WAKE_COORD)
+#include <power/wake_coord.h>
+#endif
+
 /** Render tick; lower = smoother fades, more CPU. */
 #define RGB_LED_TICK_MS  (40)
 #define RGB_CHANNEL_MAX  (255) /* led_color is 8-bit per channel */
@@ -29,11 +35,25 @@ static void apply(struct rgb_led *led, struct led_color c)
 	(void)led_set_brightness(led->pwm, led->ch_b, to_pct(c.b));
 }
 
-static void tick_fn(struct k_work *work)
+/* Delay to the next RGB_LED_TICK_MS boundary of the uptime clock: every tick
+ * in the system shares that deadline, so their wakeups coalesce. */
+static k_timeout_t next_tick(void)
 {
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct rgb_led *led = CONTAINER_OF(dwork, struct rgb_led, tick);
+	return K_MSEC(RGB_LED_TICK_MS - (k_uptime_get_32() % RGB_LED_TICK_MS));
+}
+
+/* Ticks stay off the wake coordinator (a 40 ms client would re-plan it every
+ * frame), but while animating the CPU is up anyway: serve open windows. */
+static void tick_opportunity(void)
+{
+#if defined(CONFIG_NRFMODULE_WAKE_COORD)
+	wake_coord_opportunity();
+#endif
+}
 
+/* Render one LED now; true while it still has a live layer. */
+static bool render(struct rgb_led *led)
+{
 	k_mutex_lock(&led->lock, K_FOREVER);
 	const uint32_t now = k_uptime_get_32();
 	const struct led_color c = led_arbiter_render(&led->arbiter, now);
@@ -42,15 +62,48 @@ static void tick_fn(struct k_work *work)
 	k_mutex_unlock(&led->lock);
 
 	apply(led, c);
+	return active;
+}
+
+static void tick_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct rgb_led *led = CONTAINER_OF(dwork, struct rgb_led, tick);
+
+	tick_opportunity();
+
+	/* Joined a group while rendering: the group tick owns this LED now. */
+	if (render(led) && led->group == NULL) {
+		(void)k_work_reschedule(&led->tick, next_tick());
+	}
+}
+
+static void group_tick_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct rgb_led_group *group = CONTAINER_OF(dwork, struct rgb_led_group, tick);
+	struct rgb_led *led;
+	bool active = false;
+
+	tick_opportunity();
+
+	k_mutex_lock(&group->lock, K_FOREVER);
+	SYS_SLIST_FOR_EACH_CONTAINER(&group->leds, led, node) {
+		active |= render(led);
+	}
+	k_mutex_unlock(&group->lock);
 
 	if (active) {
-		(void)k_work_reschedule(&led->tick, K_MSEC(RGB_LED_TICK_MS));
+		(void)k_work_reschedule(&group->tick, next_tick());
 	}
 }
 
 static void kick(struct rgb_led *led)
 {
-	(void)k_work_reschedule(&led->tick, K_NO_WAIT);
+	struct k_work_delayable *tick = (led->group != NULL) ? &led->group->tick
+							      : &led->tick;
+
+	(void)k_work_reschedule(tick, K_NO_WAIT);
 }
 
 int rgb_led_init(struct rgb_led *led)
@@ -62,6 +115,7 @@ int rgb_led_init(struct rgb_led *led)
 	led_arbiter_init(&led->arbiter);
 	k_mutex_init(&led->lock);
 	k_work_init_delayable(&led->tick, tick_fn);
+	led->group = NULL;
 	apply(led, (struct led_color){ 0, 0, 0 });
 	return 0;
 }
@@ -82,3 +136,43 @@ void rgb_led_clear(struct rgb_led *led, uint8_t layer)
 	k_mutex_unlock(&led->lock);
 	kick(led);
 }
+
+void rgb_led_set_blend(struct rgb_led *led, uint8_t layer, enum led_blend blend,
+		       uint8_t weight)
+{
+	k_mutex_lock(&led->lock, K_FOREVER);
+	led_arbiter_set_blend(&led->arbiter, layer, blend, weight);
+	k_mutex_unlock(&led->lock);
+	kick(led);
+}
+
+void rgb_led_group_init(struct rgb_led_group *group)
+{
+	sys_slist_init(&group->leds);
+	k_mutex_init(&group->lock);
+	k_work_init_delayable(&group->tick, group_tick_fn);
+}
+
+int rgb_led_group_add(struct rgb_led_group *group, struct rgb_led *led)
+{
+	struct k_work_sync sync;
+
+	k_mutex_lock(&led->lock, K_FOREVER);
+	if (led->group != NULL) {
+		k_mutex_unlock(&led->lock);
+		return -EALREADY;
+	}
+	led->group = group;
+	k_mutex_unlock(&led->lock);
+
+	/* group is set first, so a tick already running does not re-arm; the
+	 * sync cancel then waits it out. */
+	(void)k_work_cancel_delayable_sync(&led->tick, &sync);
+
+	k_mutex_lock(&group->lock, K_FOREVER);
+	sys_slist_append(&group->leds, &led->node);
+	k_mutex_unlock(&group->lock);
+
+	kick(led);
+	return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Battery monitor: the voltage-divider node's ADC channel, sampled from a
+ * wake_coord client so the period shares wakes with other subsystems. On
+ * the nRF SAADC a non-zero oversampling also turns on burst mode, so one
+ * read is one trigger and 2^N back-to-back conversions averaged in
+ * hardware; the ADC is enabled only for that read. Filter and SoC curve are
+ * in batt_soc.c.
+ */
+
+#include <power/batt_mon.h>
+#include <power/batt_soc.h>
+#include <power/wake_coord.h>
+
+#include <errno.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#if defined(CONFIG_NRFMODULE_BATT_MON_MODEM_IDLE)
+#include <sm_modem_power_mgmt.h>
+#endif
+
+LOG_MODULE_REGISTER(nrfmodule_batt_mon, LOG_LEVEL_INF);
+
+#define BATT_NODE DT_COMPAT_GET_ANY_STATUS_OKAY(voltage_divider)
+
+BUILD_ASSERT(DT_NODE_EXISTS(BATT_NODE), "no voltage-divider node");
+
+#define FULL_OHMS   DT_PROP(BATT_NODE, full_ohms)
+#define OUTPUT_OHMS DT_PROP(BATT_NODE, output_ohms)
+
+static const struct adc_dt_spec adc = ADC_DT_SPEC_GET(BATT_NODE);
+
+static struct batt_filter filter;
+static struct batt_mon_state latest;
+static bool have_sample;
+static bool calibrated;
+static uint8_t deferrals;
+static bool force_next;
+static K_MUTEX_DEFINE(lock);
+
+static void sample_fn(struct wake_client *client);
+static struct wake_client waker = {
+	.name = "batt_mon",
+	.fn = sample_fn,
+};
+
+/* Next sample in delay_ms, or up to slack_ms earlier if something else
+ * wakes the CPU then. */
+static void arm(uint32_t delay_ms, uint32_t slack_ms)
+{
+	wake_coord_request(&waker, k_uptime_get() + delay_ms, slack_ms);
+}
+
+static void arm_period(void)
+{
+	arm(CONFIG_NRFMODULE_BATT_MON_INTERVAL_S * MSEC_PER_SEC,
+	    CONFIG_NRFMODULE_BATT_MON_SLACK_S * MSEC_PER_SEC);
+}
+
+static bool modem_quiet(void)
+{
+#if defined(CONFIG_NRFMODULE_BATT_MON_MODEM_IDLE)
+	return sm_modem_power_mgmt_get_state() == SM_MODEM_STATE_IDLE;
+#else
+	return true;
+#endif
+}
+
+static int read_mv(uint16_t *mv)
+{
+	int16_t raw;
+	int32_t val;
+	struct adc_sequence seq = {
+		.buffer = &raw,
+		.buffer_size = sizeof(raw),
+	};
+	int err;
+
+	(void)adc_sequence_init_dt(&adc, &seq);
+	seq.oversampling = CONFIG_NRFMODULE_BATT_MON_OVERSAMPLING;
+	/* Offset calibration once; it costs more than the sample itself. */
+	seq.calibrate = !calibrated;
+
+	err = adc_read(adc.dev, &seq);
+	if (err) {
+		return err;
+	}
+	calibrated = true;
+
+	/* Single-ended inputs can read slightly below zero. */
+	val = MAX(raw, 0);
+	err = adc_raw_to_millivolts_dt(&adc, &val);
+	if (err) {
+		return err;
+	}
+
+	*mv = (uint16_t)MIN((int64_t)val * FULL_OHMS / OUTPUT_OHMS, UINT16_MAX);
+
+	return 0;
+}
+
+static void accept(uint16_t mv, bool under_load)
+{
+	k_mutex_lock(&lock, K_FOREVER);
+	latest.mv = batt_filter_update(&filter, mv);
+	latest.soc_pct = batt_soc_from_mv(batt_soc_lipo, batt_soc_lipo_len, latest.mv);
+	latest.taken_ms = k_uptime_get();
+	latest.under_load = under_load;
+	have_sample = true;
+	k_mutex_unlock(&lock);
+}
+
+/* Push the sample back while the modem is busy, at most MAX_DEFERRALS
+ * times; then wait out the period and take the next one regardless. */
+static void defer(void)
+{
+	if (++deferrals < CONFIG_NRFMODULE_BATT_MON_MAX_DEFERRALS) {
+		arm(CONFIG_NRFMODULE_BATT_MON_RETRY_MS, 0);
+		return;
+	}
+
+	LOG_DBG("modem busy for %u retries, forcing the next sample", deferrals);
+	deferrals = 0;
+	force_next = true;
+	arm_period();
+}
+
+static void sample_fn(struct wake_client *client)
+{
+	const bool force = force_next;
+	uint16_t mv;
+	int err;
+
+	ARG_UNUSED(client);
+
+	if (!force && !modem_quiet()) {
+		defer();
+		return;
+	}
+
+	err = read_mv(&mv);
+	if (err) {
+		LOG_WRN("read failed: %d", err);
+	} else if (!modem_quiet()) {
+		/* The modem woke during the burst: the sample may have sagged. */
+		if (!force) {
+			defer();
+			return;
+		}
+		accept(mv, true);
+	} else {
+		accept(mv, false);
+	}
+
+	deferrals = 0;
+	force_next = false;
+	arm_period();
+}
+
+int batt_mon_init(void)
+{
+	uint16_t mv;
+	int err;
+
+	if (!adc_is_ready_dt(&adc)) {
+		return -ENODEV;
+	}
+
+	err = adc_channel_setup_dt(&adc);
+	if (err) {
+		return err;
+	}
+
+	batt_filter_init(&filter, CONFIG_NRFMODULE_BATT_MON_FILTER_SHIFT);
+
+	err = read_mv(&mv);
+	if (err) {
+		return err;
+	}
+	accept(mv, !modem_quiet());
+	LOG_INF("%u mV, %u%%", latest.mv, latest.soc_pct);
+
+	err = wake_coord_add(&waker);
+	if (err) {
+		return err;
+	}
+	arm_period();
+
+	return 0;
+}
+
+int batt_mon_get(struct batt_mon_state *state)
+{
+	int err = -ENODATA;
+
+	k_mutex_lock(&lock, K_FOREVER);
+	if (have_sample) {
+		*state = latest;
+		err = 0;
+	}
+	k_mutex_unlock(&lock);
+
+	return err;
+}
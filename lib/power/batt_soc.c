@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pure battery SoC lookup and voltage filter.
+ */
+
+#include <power/batt_soc.h>
+
+#include <zephyr/sys/util.h>
+
+const struct batt_soc_point batt_soc_lipo[] = {
+	{ 4200, 100 },
+	{ 4100, 92 },
+	{ 4000, 83 },
+	{ 3900, 72 },
+	{ 3800, 58 },
+	{ 3750, 48 },
+	{ 3700, 36 },
+	{ 3650, 24 },
+	{ 3600, 14 },
+	{ 3500, 6 },
+	{ 3400, 2 },
+	{ 3300, 0 },
+};
+
+const size_t batt_soc_lipo_len = ARRAY_SIZE(batt_soc_lipo);
+
+uint8_t batt_soc_from_mv(const struct batt_soc_point *curve, size_t n, uint16_t mv)
+{
+	if (n == 0) {
+		return 0;
+	}
+	if (mv >= curve[0].mv) {
+		return curve[0].pct;
+	}
+
+	for (size_t i = 1; i < n; i++) {
+		const struct batt_soc_point *hi = &curve[i - 1];
+		const struct batt_soc_point *lo = &curve[i];
+
+		if (mv >= lo->mv) {
+			return (uint8_t)(lo->pct + (uint32_t)(hi->pct - lo->pct) *
+					 (mv - lo->mv) / (hi->mv - lo->mv));
+		}
+	}
+
+	return curve[n - 1].pct;
+}
+
+void batt_filter_init(struct batt_filter *f, uint8_t shift)
+{
+	f->mv_q8 = 0;
+	f->shift = shift;
+	f->primed = false;
+}
+
+uint16_t batt_filter_update(struct batt_filter *f, uint16_t mv)
+{
+	const uint32_t in = (uint32_t)mv << 8;
+
+	if (!f->primed) {
+		f->mv_q8 = in;
+		f->primed = true;
+	} else if (in >= f->mv_q8) {
+		f->mv_q8 += (in - f->mv_q8) >> f->shift;
+	} else {
+		f->mv_q8 -= (f->mv_q8 - in) >> f->shift;
+	}
+
+	/* round to nearest mV */
+	return (uint16_t)((f->mv_q8 + 128) >> 8);
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Refcounted power rail: a regulator plus the PM state of the devices behind
+ * it, switched per rail_policy. Every mutator re-plans under the lock and
+ * posts the plan's next deadline to the wake coordinator, so other clients
+ * can share the rail's wakes. Pure logic is in rail_policy.c.
+ */
+
+#include <power/rail.h>
+
+#include <errno.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/regulator.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/pm/device.h>
+
+LOG_MODULE_REGISTER(nrfmodule_rail, LOG_LEVEL_INF);
+
+static void users_action(struct rail *rail, enum pm_device_action first,
+			 enum pm_device_action second)
+{
+	if (!IS_ENABLED(CONFIG_PM_DEVICE)) {
+		return;
+	}
+
+	for (uint8_t i = 0; i < rail->user_count; i++) {
+		const struct device *dev = rail->users[i]->dev;
+
+		if (dev == NULL) {
+			continue;
+		}
+		/* -EALREADY / -ENOTSUP: nothing to do for this device. */
+		(void)pm_device_action_run(dev, first);
+		(void)pm_device_action_run(dev, second);
+	}
+}
+
+static int power_up(struct rail *rail)
+{
+	/* regulator_enable() honours off-on-delay-us, so consumers see a
+	 * settled rail when TURN_ON re-initialises them. */
+	int err = regulator_enable(rail->regulator);
+
+	if (err) {
+		LOG_ERR("rail enable failed: %d", err);
+		return err;
+	}
+	rail->on = true;
+	users_action(rail, PM_DEVICE_ACTION_TURN_ON, PM_DEVICE_ACTION_RESUME);
+
+	return 0;
+}
+
+static void power_down(struct rail *rail)
+{
+	users_action(rail, PM_DEVICE_ACTION_SUSPEND, PM_DEVICE_ACTION_TURN_OFF);
+
+	int err = regulator_disable(rail->regulator);
+
+	if (err) {
+		/* Still powered: bring the consumers back rather than leave
+		 * them marked off on a live rail. */
+		LOG_ERR("rail disable failed: %d", err);
+		users_action(rail, PM_DEVICE_ACTION_TURN_ON, PM_DEVICE_ACTION_RESUME);
+		return;
+	}
+	rail->on = false;
+}
+
+/* Call with rail->lock held. */
+static void replan(struct rail *rail)
+{
+	struct rail_need needs[CONFIG_NRFMODULE_RAIL_MAX_USERS];
+	const int64_t now = k_uptime_get();
+	struct rail_plan plan;
+
+	for (uint8_t i = 0; i < rail->user_count; i++) {
+		needs[i].at_ms = rail->users[i]->next_need_ms;
+		needs[i].reinit_ms = rail->users[i]->reinit_ms;
+	}
+
+	plan = rail_policy_plan(&rail->cfg, rail->on, rail->refs, needs,
+				rail->user_count, now);
+
+	if (plan.on && !rail->on) {
+		(void)power_up(rail);
+	} else if (!plan.on && rail->on) {
+		power_down(rail);
+	}
+
+	/* No slack: an early power-up burns rail-on time and an early gate
+	 * check just re-posts the same deadline. */
+	if (plan.eval_at_ms == RAIL_NEVER) {
+		wake_coord_cancel(&rail->waker);
+	} else {
+		wake_coord_request(&rail->waker, plan.eval_at_ms, 0);
+	}
+}
+
+static void eval_fn(struct wake_client *client)
+{
+	struct rail *rail = CONTAINER_OF(client, struct rail, waker);
+
+	k_mutex_lock(&rail->lock, K_FOREVER);
+	replan(rail);
+	k_mutex_unlock(&rail->lock);
+}
+
+int rail_init(struct rail *rail, const struct device *regulator,
+	      const struct rail_policy_cfg *cfg)
+{
+	int err;
+
+	if (!device_is_ready(regulator)) {
+		return -ENODEV;
+	}
+
+	rail->regulator = regulator;
+	rail->cfg = *cfg;
+	rail->user_count = 0;
+	rail->refs = 0;
+	rail->on = false;
+	k_mutex_init(&rail->lock);
+	rail->waker.name = "rail";
+	rail->waker.fn = eval_fn;
+	err = wake_coord_add(&rail->waker);
+	if (err) {
+		return err;
+	}
+
+	/* A boot-on rail has no enable reference yet; take the one this
+	 * helper owns, so the first gate actually switches it off. */
+	if (regulator_is_enabled(regulator)) {
+		err = regulator_enable(regulator);
+		if (err) {
+			return err;
+		}
+		rail->on = true;
+		wake_coord_request(&rail->waker, k_uptime_get(), 0);
+	}
+
+	return 0;
+}
+
+int rail_user_add(struct rail *rail, struct rail_user *user)
+{
+	int ret = 0;
+
+	k_mutex_lock(&rail->lock, K_FOREVER);
+	if (rail->user_count == ARRAY_SIZE(rail->users)) {
+		ret = -ENOMEM;
+	} else {
+		user->rail = rail;
+		user->next_need_ms = RAIL_NEVER;
+		user->held = false;
+		rail->users[rail->user_count++] = user;
+	}
+	k_mutex_unlock(&rail->lock);
+
+	return ret;
+}
+
+int rail_get(struct rail_user *user)
+{
+	struct rail *rail = user->rail;
+	int err = 0;
+
+	k_mutex_lock(&rail->lock, K_FOREVER);
+	user->next_need_ms = RAIL_NEVER;
+	if (!user->held) {
+		if (!rail->on) {
+			err = power_up(rail);
+		}
+		if (!err) {
+			user->held = true;
+			rail->refs++;
+			replan(rail);
+		}
+	}
+	k_mutex_unlock(&rail->lock);
+
+	return err;
+}
+
+void rail_put(struct rail_user *user)
+{
+	struct rail *rail = user->rail;
+
+	k_mutex_lock(&rail->lock, K_FOREVER);
+	if (user->held) {
+		user->held = false;
+		rail->refs--;
+		replan(rail);
+	}
+	k_mutex_unlock(&rail->lock);
+}
+
+void rail_schedule(struct rail_user *user, int64_t at_ms)
+{
+	struct rail *rail = user->rail;
+
+	k_mutex_lock(&rail->lock, K_FOREVER);
+	user->next_need_ms = at_ms;
+	replan(rail);
+	k_mutex_unlock(&rail->lock);
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pure rail gating policy.
+ */
+
+#include <power/rail_policy.h>
+
+static bool need_live(const struct rail_policy_cfg *cfg, const struct rail_need *need,
+		      int64_t now_ms)
+{
+	return need->at_ms != RAIL_NEVER && now_ms <= need->at_ms + cfg->horizon_ms;
+}
+
+struct rail_plan rail_policy_plan(const struct rail_policy_cfg *cfg, bool on, uint16_t refs,
+				  const struct rail_need *needs, size_t n, int64_t now_ms)
+{
+	struct rail_plan plan = { .on = false, .eval_at_ms = RAIL_NEVER };
+	int64_t stale_at = RAIL_NEVER;
+	int64_t warm_at = RAIL_NEVER;
+
+	if (refs > 0) {
+		plan.on = true;
+		return plan;
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		const struct rail_need *need = &needs[i];
+		/* Power up early enough to be re-initialised on time. */
+		const int64_t lead_at = need->at_ms - cfg->settle_ms - need->reinit_ms;
+		bool hold;
+
+		if (!need_live(cfg, need, now_ms)) {
+			continue;
+		}
+
+		/* An on rail lingers while the gap is shorter than the cost of
+		 * coming back; either way the need then holds the rail until it
+		 * is claimed or goes stale. */
+		hold = lead_at <= now_ms ||
+		       (on && need->at_ms - now_ms <= (int64_t)cfg->horizon_ms + need->reinit_ms);
+
+		if (hold) {
+			plan.on = true;
+			if (need->at_ms + cfg->horizon_ms < stale_at) {
+				stale_at = need->at_ms + cfg->horizon_ms;
+			}
+		} else if (lead_at < warm_at) {
+			warm_at = lead_at;
+		}
+	}
+
+	plan.eval_at_ms = plan.on ? stale_at + 1 : warm_at;
+
+	return plan;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Wake coordinator: one delayable work item armed on wake_plan's next
+ * deadline. Client callbacks run outside the lock so they can post their
+ * next request; the timer is re-armed after they return. Alignment is in
+ * wake_plan.c.
+ */
+
+#include <power/wake_coord.h>
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+
+LOG_MODULE_REGISTER(nrfmodule_wake_coord, LOG_LEVEL_INF);
+
+BUILD_ASSERT(CONFIG_NRFMODULE_WAKE_COORD_MAX_CLIENTS <= WAKE_PLAN_MAX_REQS,
+	     "wake_plan masks are 32 bits");
+
+static struct wake_client *clients[CONFIG_NRFMODULE_WAKE_COORD_MAX_CLIENTS];
+static uint8_t client_count;
+static K_MUTEX_DEFINE(lock);
+/* Earliest open of any pending window (k_uptime_get_32() ms), read lock-free
+ * by wake_coord_opportunity(). */
+static atomic_t window_open;
+static atomic_t window_pending;
+
+static void fire_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(fire, fire_fn);
+
+/* Call with lock held. */
+static void collect(struct wake_req *reqs)
+{
+	for (uint8_t i = 0; i < client_count; i++) {
+		reqs[i].at_ms = clients[i]->at_ms;
+		reqs[i].slack_ms = clients[i]->slack_ms;
+	}
+}
+
+/* Call with lock held. */
+static void rearm(void)
+{
+	struct wake_req reqs[CONFIG_NRFMODULE_WAKE_COORD_MAX_CLIENTS];
+	struct wake_plan plan;
+
+	int64_t open = WAKE_NEVER;
+
+	collect(reqs);
+	plan = wake_plan_next(reqs, client_count);
+
+	for (uint8_t i = 0; i < client_count; i++) {
+		if (reqs[i].at_ms != WAKE_NEVER) {
+			open = MIN(open, reqs[i].at_ms - (int64_t)reqs[i].slack_ms);
+		}
+	}
+	atomic_set(&window_open, (atomic_val_t)(uint32_t)open);
+	atomic_set(&window_pending, open != WAKE_NEVER);
+
+	if (plan.at_ms == WAKE_NEVER) {
+		(void)k_work_cancel_delayable(&fire);
+	} else {
+		(void)k_work_reschedule(&fire, K_MSEC(MAX(plan.at_ms - k_uptime_get(), 0)));
+	}
+}
+
+static void fire_fn(struct k_work *work)
+{
+	struct wake_req reqs[CONFIG_NRFMODULE_WAKE_COORD_MAX_CLIENTS];
+	const int64_t now = k_uptime_get();
+	struct wake_plan plan;
+	uint32_t due;
+	int cause;
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&lock, K_FOREVER);
+	collect(reqs);
+	plan = wake_plan_next(reqs, client_count);
+	due = wake_plan_due(reqs, client_count, now);
+	/* Woken early by wake_coord_opportunity(): nobody's deadline did it. */
+	cause = (plan.at_ms <= now) ? plan.cause : -1;
+
+	for (uint8_t i = 0; i < client_count; i++) {
+		if (due & BIT(i)) {
+			clients[i]->at_ms = WAKE_NEVER;
+			if ((int)i == cause) {
+				clients[i]->caused++;
+			} else {
+				clients[i]->joined++;
+			}
+		}
+	}
+	k_mutex_unlock(&lock);
+
+	if (due != 0) {
+		LOG_DBG("wake: %s, %u served", (cause >= 0) ? clients[cause]->name : "(opportunity)",
+			POPCOUNT(due));
+	}
+
+	/* clients[] only grows, so the indices in due stay valid. */
+	for (uint8_t i = 0; i < ARRAY_SIZE(clients); i++) {
+		if (due & BIT(i)) {
+			clients[i]->fn(clients[i]);
+		}
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+	rearm();
+	k_mutex_unlock(&lock);
+}
+
+int wake_coord_add(struct wake_client *client)
+{
+	int ret = 0;
+
+	k_mutex_lock(&lock, K_FOREVER);
+	if (client_count == ARRAY_SIZE(clients)) {
+		ret = -ENOMEM;
+	} else {
+		client->at_ms = WAKE_NEVER;
+		client->slack_ms = 0;
+		client->caused = 0;
+		client->joined = 0;
+		clients[client_count++] = client;
+	}
+	k_mutex_unlock(&lock);
+
+	return ret;
+}
+
+void wake_coord_request(struct wake_client *client, int64_t at_ms, uint32_t slack_ms)
+{
+	k_mutex_lock(&lock, K_FOREVER);
+	client->at_ms = at_ms;
+	client->slack_ms = slack_ms;
+	rearm();
+	k_mutex_unlock(&lock);
+}
+
+void wake_coord_cancel(struct wake_client *client)
+{
+	k_mutex_lock(&lock, K_FOREVER);
+	client->at_ms = WAKE_NEVER;
+	rearm();
+	k_mutex_unlock(&lock);
+}
+
+void wake_coord_opportunity(void)
+{
+	const uint32_t open = (uint32_t)atomic_get(&window_open);
+
+	/* Frequent callers (every LED frame) cost two loads until a window
+	 * opens. */
+	if (!atomic_get(&window_pending) || (int32_t)(k_uptime_get_32() - open) < 0) {
+		return;
+	}
+	/* ISR-safe: the work re-plans and re-arms the timer itself. */
+	(void)k_work_reschedule(&fire, K_NO_WAIT);
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pure wake alignment.
+ */
+
+#include <power/wake_plan.h>
+
+uint32_t wake_plan_due(const struct wake_req *reqs, size_t n, int64_t now_ms)
+{
+	uint32_t mask = 0;
+
+	for (size_t i = 0; i < n && i < WAKE_PLAN_MAX_REQS; i++) {
+		if (reqs[i].at_ms != WAKE_NEVER &&
+		    reqs[i].at_ms - (int64_t)reqs[i].slack_ms <= now_ms) {
+			mask |= 1U << i;
+		}
+	}
+
+	return mask;
+}
+
+struct wake_plan wake_plan_next(const struct wake_req *reqs, size_t n)
+{
+	struct wake_plan plan = { .at_ms = WAKE_NEVER, .served = 0, .cause = -1 };
+
+	for (size_t i = 0; i < n && i < WAKE_PLAN_MAX_REQS; i++) {
+		if (reqs[i].at_ms < plan.at_ms) {
+			plan.at_ms = reqs[i].at_ms;
+			plan.cause = (int)i;
+		}
+	}
+
+	if (plan.cause >= 0) {
+		plan.served = wake_plan_due(reqs, n, plan.at_ms);
+	}
+
+	return plan;
+}
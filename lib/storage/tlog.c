@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Telemetry log: staging, flush and scan over a flash_area. Every flash
+ * access runs inside hold()/release(), one runtime-PM reference on the
+ * flash device, so the QSPI NOR leaves deep power-down once per batch.
+ * The record format and the sector index are in tlog_format.c.
+ */
+
+#include <storage/tlog.h>
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/pm/device_runtime.h>
+#include <zephyr/storage/flash_map.h>
+
+LOG_MODULE_REGISTER(nrfmodule_tlog, LOG_LEVEL_INF);
+
+/** NOR program page: a full-buffer flush writes whole pages only. */
+#define TLOG_PROG_PAGE (256U)
+
+#define SECTOR_DATA_OFF (sizeof(struct tlog_sector_hdr))
+
+/* Logging, unless the log is quiet (its owner is a log backend). */
+#define TLOG_LOG(log, level, ...)                                                          \
+	do {                                                                               \
+		if (!(log)->quiet) {                                                       \
+			LOG_##level(__VA_ARGS__);                                          \
+		}                                                                          \
+	} while (0)
+
+BUILD_ASSERT(CONFIG_NRFMODULE_TLOG_STAGE_SIZE % TLOG_PROG_PAGE == 0,
+	     "staging buffer must be whole program pages");
+
+static void hold(struct tlog *log)
+{
+	(void)pm_device_runtime_get(log->fa->fa_dev);
+}
+
+static void release(struct tlog *log)
+{
+	(void)pm_device_runtime_put(log->fa->fa_dev);
+}
+
+static off_t sector_base(const struct tlog *log, uint16_t s)
+{
+	return (off_t)s * log->sector_size;
+}
+
+static bool range_erased(struct tlog *log, off_t off, size_t len)
+{
+	uint8_t buf[sizeof(struct tlog_sector_hdr)];
+
+	if (len > sizeof(buf) || flash_area_read(log->fa, off, buf, len) != 0) {
+		return false;
+	}
+	for (size_t i = 0; i < len; i++) {
+		if (buf[i] != 0xFF) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static int erase_sector(struct tlog *log, uint16_t s)
+{
+	log->index[s].gen = 0;
+	if (log->rd_valid && log->rd_sector == s) {
+		log->rd_valid = false;
+	}
+
+	return flash_area_erase(log->fa, sector_base(log, s), log->sector_size);
+}
+
+/* Start appending to sector s (already erased), then erase the one after it
+ * so the next switch never waits on an erase. */
+static int open_sector(struct tlog *log, uint16_t s, uint32_t gen)
+{
+	struct tlog_sector_hdr hdr;
+	int err;
+
+	tlog_sector_hdr_init(&hdr, gen, log->next_seq);
+	err = flash_area_write(log->fa, sector_base(log, s), &hdr, sizeof(hdr));
+	if (err) {
+		return err;
+	}
+
+	log->index[s].gen = gen;
+	log->index[s].first_seq = log->next_seq;
+	log->head = s;
+	log->head_off = SECTOR_DATA_OFF;
+
+	return erase_sector(log, (s + 1) % log->sector_count);
+}
+
+/* Write the stage: all of it, or only up to the last page boundary. */
+static int write_stage(struct tlog *log, bool all)
+{
+	const off_t at = sector_base(log, log->head) + log->head_off;
+	const off_t abs = log->fa->fa_off + at;
+	size_t n = log->stage_len;
+	int err;
+
+	if (!all) {
+		const off_t end = ROUND_DOWN(abs + log->stage_len, TLOG_PROG_PAGE);
+
+		n = (end > abs) ? (size_t)(end - abs) : 0;
+	}
+	if (n == 0) {
+		return 0;
+	}
+
+	err = flash_area_write(log->fa, at, log->stage, n);
+	if (err) {
+		TLOG_LOG(log, ERR, "write at 0x%lx failed: %d", (long)at, err);
+		return -EIO;
+	}
+
+	log->head_off += n;
+	log->stage_len -= n;
+	memmove(log->stage, &log->stage[n], log->stage_len);
+
+	return 0;
+}
+
+/* Make room for a record of size bytes; flash is woken only if needed. */
+static int make_room(struct tlog *log, size_t size)
+{
+	const bool new_sector = log->head_off + log->stage_len + size > log->sector_size;
+	int err = 0;
+
+	if (!new_sector && log->stage_len + size <= sizeof(log->stage)) {
+		return 0;
+	}
+
+	hold(log);
+	if (new_sector) {
+		err = write_stage(log, true);
+		if (!err) {
+			err = open_sector(log, (log->head + 1) % log->sector_count,
+					  log->index[log->head].gen + 1);
+		}
+	} else {
+		err = write_stage(log, false);
+		if (!err && log->stage_len + size > sizeof(log->stage)) {
+			err = write_stage(log, true);
+		}
+	}
+	release(log);
+
+	return err ? -EIO : 0;
+}
+
+/* Walk the head sector for the append point and next seq. */
+static int scan_head(struct tlog *log)
+{
+	const off_t base = sector_base(log, log->head);
+	uint32_t off = SECTOR_DATA_OFF;
+	struct tlog_rec_hdr hdr;
+
+	log->next_seq = log->index[log->head].first_seq;
+
+	while (off + sizeof(hdr) <= log->sector_size) {
+		if (flash_area_read(log->fa, base + off, &hdr, sizeof(hdr)) != 0) {
+			return -EIO;
+		}
+		if (tlog_rec_hdr_erased(&hdr)) {
+			break;
+		}
+		if (!tlog_rec_hdr_plausible(&hdr)) {
+			/* Torn header: its length is unknown, so seal the
+			 * sector; the next append opens a fresh one. */
+			TLOG_LOG(log, WRN, "sector %u: bad record at 0x%x, sealed", log->head,
+				 off);
+			off = log->sector_size;
+			break;
+		}
+		log->next_seq = hdr.seq + 1;
+		off += tlog_rec_size(hdr.len);
+	}
+
+	log->head_off = MIN(off, log->sector_size);
+
+	return 0;
+}
+
+static int mount(struct tlog *log)
+{
+	uint16_t ahead;
+	int newest;
+	int err;
+
+	for (uint16_t s = 0; s < log->sector_count; s++) {
+		struct tlog_sector_hdr hdr;
+
+		if (flash_area_read(log->fa, sector_base(log, s), &hdr, sizeof(hdr)) != 0) {
+			return -EIO;
+		}
+		log->index[s].gen = tlog_sector_hdr_valid(&hdr) ? hdr.gen : 0;
+		log->index[s].first_seq = hdr.first_seq;
+	}
+
+	newest = tlog_index_newest(log->index, log->sector_count);
+	if (newest < 0) {
+		TLOG_LOG(log, INF, "empty, formatting %u sectors", log->sector_count);
+		log->next_seq = 0;
+		err = erase_sector(log, 0);
+		return err ? err : open_sector(log, 0, 1);
+	}
+
+	log->head = (uint16_t)newest;
+	err = scan_head(log);
+	if (err) {
+		return err;
+	}
+
+	/* Re-establish erase-ahead: a cut during a sector switch can leave the
+	 * next sector holding old data or a torn header. */
+	ahead = (log->head + 1) % log->sector_count;
+	if (log->index[ahead].gen != 0 ||
+	    !range_erased(log, sector_base(log, ahead), SECTOR_DATA_OFF)) {
+		return erase_sector(log, ahead);
+	}
+
+	return 0;
+}
+
+int tlog_init(struct tlog *log, uint8_t area_id)
+{
+	struct flash_pages_info info;
+	int err;
+
+	err = flash_area_open(area_id, &log->fa);
+	if (err) {
+		return err;
+	}
+
+	err = flash_get_page_info_by_offs(log->fa->fa_dev, log->fa->fa_off, &info);
+	if (err) {
+		return -EIO;
+	}
+
+	log->sector_size = info.size;
+	log->sector_count = log->fa->fa_size / info.size;
+	if (log->sector_count < 2 || log->sector_count > ARRAY_SIZE(log->index)) {
+		TLOG_LOG(log, ERR, "%u sectors: need 2..%u", log->sector_count,
+			 (unsigned int)ARRAY_SIZE(log->index));
+		return -EINVAL;
+	}
+
+	log->head = 0;
+	log->stage_len = 0;
+	log->rd_valid = false;
+	k_mutex_init(&log->lock);
+
+	hold(log);
+	err = mount(log);
+	release(log);
+
+	if (err) {
+		return -EIO;
+	}
+
+	TLOG_LOG(log, INF, "seq %u..%u, head sector %u", tlog_oldest_seq(log), log->next_seq,
+		 log->head);
+
+	return 0;
+}
+
+int tlog_append(struct tlog *log, const void *data, uint16_t len)
+{
+	const size_t size = tlog_rec_size(len);
+	int err;
+
+	if (len > TLOG_REC_MAX_LEN || size > sizeof(log->stage) ||
+	    size > log->sector_size - SECTOR_DATA_OFF) {
+		return -EMSGSIZE;
+	}
+
+	k_mutex_lock(&log->lock, K_FOREVER);
+	err = make_room(log, size);
+	if (!err) {
+		(void)tlog_rec_encode(&log->stage[log->stage_len],
+				      sizeof(log->stage) - log->stage_len,
+				      log->next_seq, data, len);
+		log->stage_len += size;
+		log->next_seq++;
+	}
+	k_mutex_unlock(&log->lock);
+
+	return err;
+}
+
+int tlog_flush(struct tlog *log)
+{
+	int err = 0;
+
+	k_mutex_lock(&log->lock, K_FOREVER);
+	if (log->stage_len > 0) {
+		hold(log);
+		err = write_stage(log, true);
+		release(log);
+	}
+	k_mutex_unlock(&log->lock);
+
+	return err;
+}
+
+/* Find seq in sector s from off onward; on success *off is its header. */
+static int walk_to(struct tlog *log, uint16_t s, uint32_t *off, uint32_t seq,
+		   struct tlog_rec_hdr *hdr)
+{
+	const off_t base = sector_base(log, s);
+
+	while (*off + sizeof(*hdr) <= log->sector_size) {
+		if (flash_area_read(log->fa, base + *off, hdr, sizeof(*hdr)) != 0) {
+			return -EIO;
+		}
+		if (!tlog_rec_hdr_plausible(hdr)) {
+			return -ENOENT;
+		}
+		if (hdr->seq == seq) {
+			return 0;
+		}
+		*off += tlog_rec_size(hdr->len);
+	}
+
+	return -ENOENT;
+}
+
+static int read_locked(struct tlog *log, uint32_t seq, void *buf, size_t cap)
+{
+	struct tlog_rec_hdr hdr;
+	uint16_t s;
+	uint32_t off;
+	int idx;
+	int err = -ENOENT;
+
+	if (log->rd_valid && log->rd_seq == seq) {
+		s = log->rd_sector;
+		off = log->rd_off;
+		err = walk_to(log, s, &off, seq, &hdr);
+	}
+	if (err == -ENOENT) {
+		/* Cursor ran off its sector (or none): look seq up. */
+		idx = tlog_index_find(log->index, log->sector_count, seq);
+		if (idx < 0) {
+			return -ENOENT;
+		}
+		s = (uint16_t)idx;
+		off = SECTOR_DATA_OFF;
+		err = walk_to(log, s, &off, seq, &hdr);
+	}
+	if (err) {
+		return err;
+	}
+
+	if (hdr.len > cap) {
+		return -ENOBUFS;
+	}
+	if (flash_area_read(log->fa, sector_base(log, s) + off + sizeof(hdr), buf,
+			    hdr.len) != 0) {
+		return -EIO;
+	}
+	if (!tlog_rec_crc_ok(&hdr, buf)) {
+		return -EBADMSG;
+	}
+
+	log->rd_valid = true;
+	log->rd_sector = s;
+	log->rd_off = off + tlog_rec_size(hdr.len);
+	log->rd_seq = seq + 1;
+
+	return hdr.len;
+}
+
+int tlog_read(struct tlog *log, uint32_t seq, void *buf, size_t cap)
+{
+	int ret;
+
+	k_mutex_lock(&log->lock, K_FOREVER);
+	if ((int32_t)(seq - log->next_seq) >= 0) {
+		k_mutex_unlock(&log->lock);
+		return -ENODATA;
+	}
+
+	hold(log);
+	ret = write_stage(log, true);
+	if (ret == 0) {
+		ret = read_locked(log, seq, buf, cap);
+	}
+	release(log);
+	k_mutex_unlock(&log->lock);
+
+	return ret;
+}
+
+uint32_t tlog_oldest_seq(struct tlog *log)
+{
+	int oldest;
+	uint32_t seq;
+
+	k_mutex_lock(&log->lock, K_FOREVER);
+	oldest = tlog_index_oldest(log->index, log->sector_count);
+	seq = (oldest < 0) ? log->next_seq : log->index[oldest].first_seq;
+	k_mutex_unlock(&log->lock);
+
+	return seq;
+}
+
+uint32_t tlog_next_seq(struct tlog *log)
+{
+	uint32_t seq;
+
+	k_mutex_lock(&log->lock, K_FOREVER);
+	seq = log->next_seq;
+	k_mutex_unlock(&log->lock);
+
+	return seq;
+}
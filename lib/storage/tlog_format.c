@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pure telemetry-log record format and sector index.
+ */
+
+#include <storage/tlog_format.h>
+
+#include <string.h>
+#include <zephyr/sys/crc.h>
+
+#define ERASED (0xFF)
+
+static uint32_t rec_crc(uint16_t len, uint32_t seq, const void *payload)
+{
+	uint32_t crc = crc32_ieee_update(0, (const uint8_t *)&len, sizeof(len));
+
+	crc = crc32_ieee_update(crc, (const uint8_t *)&seq, sizeof(seq));
+
+	return crc32_ieee_update(crc, payload, len);
+}
+
+void tlog_sector_hdr_init(struct tlog_sector_hdr *hdr, uint32_t gen, uint32_t first_seq)
+{
+	hdr->magic = TLOG_SECTOR_MAGIC;
+	hdr->gen = gen;
+	hdr->first_seq = first_seq;
+	hdr->crc = crc32_ieee((const uint8_t *)hdr, offsetof(struct tlog_sector_hdr, crc));
+}
+
+bool tlog_sector_hdr_valid(const struct tlog_sector_hdr *hdr)
+{
+	return hdr->magic == TLOG_SECTOR_MAGIC && hdr->gen != 0 &&
+	       hdr->crc == crc32_ieee((const uint8_t *)hdr,
+				      offsetof(struct tlog_sector_hdr, crc));
+}
+
+size_t tlog_rec_encode(uint8_t *dst, size_t cap, uint32_t seq, const void *data, uint16_t len)
+{
+	const size_t size = tlog_rec_size(len);
+	struct tlog_rec_hdr hdr;
+
+	if (len > TLOG_REC_MAX_LEN || size > cap) {
+		return 0;
+	}
+
+	hdr.magic = TLOG_REC_MAGIC;
+	hdr.len = len;
+	hdr.seq = seq;
+	hdr.crc = rec_crc(len, seq, data);
+
+	memcpy(dst, &hdr, sizeof(hdr));
+	memcpy(dst + sizeof(hdr), data, len);
+	/* Padding stays erased, so a later program of it is a no-op. */
+	memset(dst + sizeof(hdr) + len, ERASED, size - sizeof(hdr) - len);
+
+	return size;
+}
+
+bool tlog_rec_hdr_erased(const struct tlog_rec_hdr *hdr)
+{
+	const uint8_t *p = (const uint8_t *)hdr;
+
+	for (size_t i = 0; i < sizeof(*hdr); i++) {
+		if (p[i] != ERASED) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool tlog_rec_hdr_plausible(const struct tlog_rec_hdr *hdr)
+{
+	return hdr->magic == TLOG_REC_MAGIC && hdr->len <= TLOG_REC_MAX_LEN;
+}
+
+bool tlog_rec_crc_ok(const struct tlog_rec_hdr *hdr, const void *payload)
+{
+	return hdr->crc == rec_crc(hdr->len, hdr->seq, payload);
+}
+
+int tlog_index_newest(const struct tlog_index_entry *idx, size_t n)
+{
+	int best = -1;
+
+	for (size_t i = 0; i < n; i++) {
+		if (idx[i].gen != 0 && (best < 0 || idx[i].gen > idx[best].gen)) {
+			best = (int)i;
+		}
+	}
+
+	return best;
+}
+
+int tlog_index_oldest(const struct tlog_index_entry *idx, size_t n)
+{
+	int best = -1;
+
+	for (size_t i = 0; i < n; i++) {
+		if (idx[i].gen != 0 && (best < 0 || idx[i].gen < idx[best].gen)) {
+			best = (int)i;
+		}
+	}
+
+	return best;
+}
+
+/* seq a is at or after b, modulo wrap. */
+static bool seq_ge(uint32_t a, uint32_t b)
+{
+	return (int32_t)(a - b) >= 0;
+}
+
+int tlog_index_find(const struct tlog_index_entry *idx, size_t n, uint32_t seq)
+{
+	const int oldest = tlog_index_oldest(idx, n);
+	size_t count = 0;
+	size_t lo;
+	size_t hi;
+
+	if (oldest < 0) {
+		return -1;
+	}
+
+	/* Written sectors run contiguously around the ring from the oldest. */
+	while (count < n && idx[(oldest + count) % n].gen != 0) {
+		count++;
+	}
+
+	if (!seq_ge(seq, idx[oldest].first_seq)) {
+		return -1;
+	}
+
+	/* Largest k in [0, count) with first_seq(k) <= seq. */
+	lo = 0;
+	hi = count - 1;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo + 1) / 2;
+
+		if (seq_ge(seq, idx[(oldest + mid) % n].first_seq)) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return (int)((oldest + lo) % n);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * USB VBUS power manager, configured by the nrfmodule,usb-power node. USBD
+ * messages only re-arm the debounce work; the work reads the settled VBUS
+ * level from POWER and applies it once, so a bouncing plug costs one
+ * usbd_enable()/usbd_disable() at most.
+ */
+
+#include <usb/usb_power.h>
+
+#include <errno.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/usb/usbd.h>
+#include <zephyr/usb/usbd_msg.h>
+#include <hal/nrf_power.h>
+
+LOG_MODULE_REGISTER(nrfmodule_usb_power, LOG_LEVEL_INF);
+
+#define USB_POWER_NODE DT_COMPAT_GET_ANY_STATUS_OKAY(nrfmodule_usb_power)
+
+#define DEBOUNCE_MS DT_PROP(USB_POWER_NODE, debounce_ms)
+
+/* SYS_INIT priority must be a bare integer (token-pasted into linker section name).
+ * Must run after cdc_acm_serial SYS_INIT which uses APPLICATION priority 90.
+ * Same priority is safe - this library links after the USB subsystem.
+ */
+#define USB_POWER_INIT_PRIORITY 90 /* style:no-paren — SYS_INIT pastes the priority, brackets break the build */
+
+static const char *const usb_backend = DT_PROP(USB_POWER_NODE, usb_log_backend);
+
+#define FALLBACK_SET(node, prop, idx, on) backend_set(DT_PROP_BY_IDX(node, prop, idx), on);
+
+/* -1 until the first settle, so boot state is always applied. */
+static atomic_t attached = ATOMIC_INIT(-1);
+static struct usbd_context *usb_ctx;
+
+static void settle_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(settle_work, settle_fn);
+
+static void backend_set(const char *name, bool on)
+{
+#if defined(CONFIG_LOG) && !defined(CONFIG_LOG_MODE_MINIMAL)
+	const struct log_backend *backend = log_backend_get_by_name(name);
+
+	if (backend == NULL) {
+		return;
+	}
+
+	if (on && !log_backend_is_active(backend)) {
+		log_backend_enable(backend, backend->cb->ctx, CONFIG_LOG_MAX_LEVEL);
+	} else if (!on && log_backend_is_active(backend)) {
+		log_backend_disable(backend);
+	}
+#else
+	ARG_UNUSED(name);
+	ARG_UNUSED(on);
+#endif
+}
+
+static void log_route(bool usb)
+{
+	backend_set(usb_backend, usb);
+
+	COND_CODE_1(DT_NODE_HAS_PROP(USB_POWER_NODE, fallback_log_backends),
+		    (DT_FOREACH_PROP_ELEM_VARGS(USB_POWER_NODE, fallback_log_backends,
+						FALLBACK_SET, !usb)),
+		    ());
+}
+
+static void settle_fn(struct k_work *work)
+{
+	const bool vbus = nrf_power_usbregstatus_vbusdet_get(NRF_POWER);
+	int err;
+
+	ARG_UNUSED(work);
+
+	if (atomic_get(&attached) == (atomic_val_t)vbus) {
+		return;
+	}
+
+	if (vbus) {
+		err = usbd_enable(usb_ctx);
+		if (err && err != -EALREADY) {
+			LOG_ERR("usbd_enable failed: %d", err);
+			return;
+		}
+		log_route(true);
+		LOG_DBG("USB plugged in - USBD enabled");
+	} else {
+		/* Move logging off the port before it goes away. */
+		log_route(false);
+		err = usbd_disable(usb_ctx);
+		if (err && err != -EALREADY) {
+			LOG_ERR("usbd_disable failed: %d", err);
+		}
+		LOG_DBG("USB unplugged - USBD disabled");
+	}
+
+	atomic_set(&attached, vbus);
+}
+
+static void usbd_msg_cb(struct usbd_context *const ctx, const struct usbd_msg *const msg)
+{
+	ARG_UNUSED(ctx);
+
+	switch (msg->type) {
+	case USBD_MSG_VBUS_REMOVED:
+	case USBD_MSG_VBUS_READY:
+		/* Each edge restarts the window. */
+		(void)k_work_reschedule(&settle_work, K_MSEC(DEBOUNCE_MS));
+		break;
+	default:
+		break;
+	}
+}
+
+bool usb_power_attached(void)
+{
+	return atomic_get(&attached) == 1;
+}
+
+static int usb_power_init(void)
+{
+	int err;
+
+	STRUCT_SECTION_FOREACH(usbd_context, entry) {
+		usb_ctx = entry;
+		break;
+	}
+
+	if (usb_ctx == NULL) {
+		LOG_WRN("No USBD context found");
+		return -ENODEV;
+	}
+
+	err = usbd_msg_register_cb(usb_ctx, usbd_msg_cb);
+	if (err) {
+		LOG_ERR("Failed to register USBD message callback: %d", err);
+		return err;
+	}
+
+	/* VBUS_READY is edge-only: settle the boot state once, after the log
+	 * thread has started any autostart backends. */
+	(void)k_work_schedule(&settle_work, K_MSEC(DEBOUNCE_MS));
+
+	return 0;
+}
+
+SYS_INIT(usb_power_init, APPLICATION, USB_POWER_INIT_PRIORITY);
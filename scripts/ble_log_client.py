@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+"""Stream logs from the nRFModule BLE log backend.
+
+Connects to a device advertising the log service (NRFMODULE_BLE_LOG_ADV_UUID_DATA
+in include/nrfmodule_ble_log_backend.h), subscribes to the log characteristic
+and prints what arrives. By default the stream is taken as it comes, one
+message after another, which is what the shipping backend sends.
+
+--framed decodes ble_log_frame framing (include/ble_log/ble_log_frame.h), for
+firmware whose backend has adopted it: several messages per notification
+behind a 4-byte header, with a sequence number so lost frames show up as gaps.
+In that mode, logs stored while nobody was connected
+(CONFIG_NRFMODULE_BLE_LOG_STORE) are replayed first in frames tagged as
+stored, each message carrying its record seq, and missing seqs are reported.
+Compressed frames (CONFIG_NRFMODULE_BLE_LOG_LZ) are expanded first. Drop
+reports from a congested link print in place as "--- N messages dropped ---".
+
+Text builds print as they are. Dictionary builds
+(CONFIG_LOG_BACKEND_NRFMODULE_BLE_LOG_OUTPUT_DICTIONARY) are decoded with
+Zephyr's dictionary parser against the log database of the exact build that is
+running on the device.
+
+Usage:
+    python scripts/ble_log_client.py --name LiveTracker
+    python scripts/ble_log_client.py --address C0:FF:EE:00:00:01 \\
+        --dictionary build/zephyr/log_dictionary.json
+    python scripts/ble_log_client.py --name LiveTracker --dump capture.bin
+    python scripts/ble_log_client.py --name LiveTracker --framed
+    python scripts/ble_log_client.py --replay capture.bin \\
+        --dictionary build/zephyr/log_dictionary.json
+
+--dump writes the notifications as plain bytes, or with --framed each as a
+u16 little-endian length and the frame; --replay reads either back (pass
+--framed again for a framed capture).
+
+Live capture needs `bleak`; --dictionary needs ZEPHYR_BASE for
+scripts/logging/dictionary.
+"""
+
+import argparse
+import asyncio
+import os
+import struct
+import sys
+
+# Little-endian bytes of NRFMODULE_BLE_LOG_ADV_UUID_DATA, as a UUID string.
+SERVICE_UUID = "6e400001-b5a3-f393-e0a9-e50e24dcca00"
+# NUS layout: TX (device -> host, notify) is ...0003 under the same base.
+LOG_CHAR_UUID = "6e400003-b5a3-f393-e0a9-e50e24dcca00"
+
+# ble_log_frame.h
+FRAME_VERSION = 1
+FRAME_HDR_SIZE = 4
+FRAME_NO_START = 0xFF
+FRAME_F_STORED = 0x01
+FRAME_F_LZ = 0x02
+FRAME_F_DROPS = 0x04
+STORED_HDR_SIZE = 6
+
+# ble_log_lz.c: the primed window every compressed frame starts from.
+LZ_DICT = (b": 0x00000000\r\n"
+           b"[00:00:00.000,000] <err> "
+           b"[00:00:00.000,000] <wrn> "
+           b"[00:00:00.000,000] <dbg> "
+           b"[00:00:00.000,000] <inf> ")
+
+
+def lz_decode(payload: bytes, first: int):
+    """Expand one ble_log_lz frame; also map @first to the expanded offset."""
+    out = bytearray(LZ_DICT)
+    pos = 0
+    mapped = FRAME_NO_START
+    while pos < len(payload):
+        if pos == first:
+            mapped = len(out) - len(LZ_DICT)
+        token = payload[pos]
+        pos += 1
+        if token < 0x80:
+            out += payload[pos:pos + token + 1]
+            pos += token + 1
+            continue
+        if pos == len(payload):
+            raise ValueError("truncated match")
+        length = ((token >> 2) & 0x1F) + 3
+        offset = (((token & 0x03) << 8) | payload[pos]) + 1
+        pos += 1
+        if offset > len(out):
+            raise ValueError("match before the window")
+        for _ in range(length):
+            out.append(out[-offset])
+    return bytes(out[len(LZ_DICT):]), mapped
+
+
+class TextSink:
+    """Print text logs, holding back a partial last line."""
+
+    def __init__(self):
+        self.pending = b""
+
+    def feed(self, data: bytes):
+        self.pending += data
+        *lines, self.pending = self.pending.split(b"\n")
+        for line in lines:
+            print(line.decode("utf-8", errors="replace").rstrip("\r"), flush=True)
+
+    def reset(self):
+        self.pending = b""
+
+    def close(self):
+        if self.pending:
+            print(self.pending.decode("utf-8", errors="replace"), flush=True)
+
+
+class DictionarySink:
+    """Decode dictionary-based log messages as they arrive."""
+
+    def __init__(self, database_path: str, debug: bool):
+        zephyr_base = os.environ.get("ZEPHYR_BASE")
+        if not zephyr_base:
+            sys.exit("error: --dictionary needs ZEPHYR_BASE set")
+        sys.path.insert(0, os.path.join(zephyr_base, "scripts", "logging", "dictionary"))
+
+        import dictionary_parser  # pylint: disable=import-outside-toplevel
+        from dictionary_parser.log_database import LogDatabase  # pylint: disable=import-outside-toplevel
+
+        database = LogDatabase.read_json_database(database_path)
+        if database is None:
+            sys.exit(f"error: cannot read log database {database_path}")
+        self.parser = dictionary_parser.get_parser(database)
+        if self.parser is None:
+            sys.exit("error: unsupported log database version")
+        self.debug = debug
+        self.pending = bytearray()
+
+    def feed(self, data: bytes):
+        self.pending += data
+        consumed = self.parser.parse_log_data(bytes(self.pending), debug=self.debug)
+        if isinstance(consumed, bool):
+            # Older parsers take whole buffers and report success only.
+            self.pending.clear()
+        else:
+            del self.pending[:consumed]
+
+    def reset(self):
+        self.pending.clear()
+
+    def close(self):
+        if self.pending:
+            print(f"[ble_log] {len(self.pending)} trailing bytes not decoded", file=sys.stderr)
+
+
+class FrameDecoder:
+    """Strip ble_log_frame headers and resync the sink after lost frames."""
+
+    def __init__(self, sink):
+        self.sink = sink
+        self.next_seq = None
+        self.synced = True
+        self.lost = 0
+        self.stored = False
+        self.rec_buf = bytearray()
+        self.rec_seq = None
+
+    def feed(self, frame: bytes):
+        if len(frame) < FRAME_HDR_SIZE:
+            print(f"[ble_log] short frame ({len(frame)} bytes)", file=sys.stderr)
+            return
+        flags, first, seq = struct.unpack_from("<BBH", frame)
+        if flags >> 4 != FRAME_VERSION:
+            sys.exit(f"error: frame version {flags >> 4}, expected {FRAME_VERSION} "
+                     "(unframed stream? drop --framed)")
+        payload = frame[FRAME_HDR_SIZE:]
+        if flags & FRAME_F_LZ:
+            try:
+                payload, first = lz_decode(payload, first)
+            except ValueError as e:
+                print(f"[ble_log] bad compressed frame {seq}: {e}", file=sys.stderr)
+                self.sink.reset()
+                self.rec_buf.clear()
+                self.synced = False
+                self.next_seq = (seq + 1) & 0xFFFF
+                return
+
+        if self.next_seq is not None and seq != self.next_seq:
+            gap = (seq - self.next_seq) & 0xFFFF
+            self.lost += gap
+            print(f"[ble_log] {gap} frame(s) lost before seq {seq}", file=sys.stderr)
+            self.sink.reset()
+            self.rec_buf.clear()
+            self.synced = False
+        self.next_seq = (seq + 1) & 0xFFFF
+
+        if flags & FRAME_F_DROPS:
+            if len(payload) >= 16:
+                err, wrn, inf, dbg = struct.unpack_from("<4I", payload)
+                print(f"--- {err + wrn + inf + dbg} messages dropped "
+                      f"(err {err}, wrn {wrn}, inf {inf}, dbg {dbg}) ---", flush=True)
+            return
+
+        stored = bool(flags & FRAME_F_STORED)
+        if stored != self.stored:
+            print("[ble_log] stored logs:" if stored else "[ble_log] live:", file=sys.stderr)
+            self.stored = stored
+
+        if not self.synced:
+            if first == FRAME_NO_START:
+                return
+            payload = payload[first:]
+            self.synced = True
+        if stored:
+            self.feed_stored(payload)
+        else:
+            self.sink.feed(payload)
+
+    def feed_stored(self, payload: bytes):
+        """Unwrap (seq u32, len u16, message) records, which may span frames."""
+        self.rec_buf += payload
+        while len(self.rec_buf) >= STORED_HDR_SIZE:
+            seq, length = struct.unpack_from("<IH", self.rec_buf)
+            if len(self.rec_buf) < STORED_HDR_SIZE + length:
+                break
+            msg = bytes(self.rec_buf[STORED_HDR_SIZE:STORED_HDR_SIZE + length])
+            del self.rec_buf[:STORED_HDR_SIZE + length]
+
+            if self.rec_seq is not None and seq <= self.rec_seq:
+                continue  # replayed again after a reboot, already shown
+            if self.rec_seq is not None and seq != self.rec_seq + 1:
+                print(f"[ble_log] {seq - self.rec_seq - 1} stored record(s) lost before {seq}",
+                      file=sys.stderr)
+            self.rec_seq = seq
+            self.sink.feed(msg)
+
+    def close(self):
+        self.sink.close()
+        if self.lost:
+            print(f"[ble_log] {self.lost} frame(s) lost in total", file=sys.stderr)
+
+
+def read_frames(data: bytes):
+    """Split a --dump capture back into notifications."""
+    pos = 0
+    while pos + 2 <= len(data):
+        (length,) = struct.unpack_from("<H", data, pos)
+        pos += 2
+        yield data[pos:pos + length]
+        pos += length
+
+
+async def capture(args, on_data):
+    from bleak import BleakClient, BleakScanner  # pylint: disable=import-outside-toplevel
+
+    def match(device, adv):
+        if args.address:
+            return device.address.lower() == args.address.lower()
+        if args.name:
+            return (adv.local_name or device.name) == args.name
+        return SERVICE_UUID in [u.lower() for u in adv.service_uuids]
+
+    print("[ble_log] scanning...", file=sys.stderr)
+    device = await BleakScanner.find_device_by_filter(match, timeout=args.timeout)
+    if device is None:
+        sys.exit("error: device not found")
+
+    done = asyncio.Event()
+    async with BleakClient(device, disconnected_callback=lambda _: done.set()) as client:
+        print(f"[ble_log] connected to {device.address}", file=sys.stderr)
+        await client.start_notify(args.char, lambda _, data: on_data(bytes(data)))
+        await done.wait()
+    print("[ble_log] disconnected", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group()
+    source.add_argument("--name", help="advertised device name")
+    source.add_argument("--address", help="device address (default: first with the log service)")
+    source.add_argument("--replay", metavar="FILE", help="decode a --dump capture instead of connecting")
+    parser.add_argument("--char", default=LOG_CHAR_UUID, help="log characteristic UUID")
+    parser.add_argument("--dictionary", metavar="JSON", help="build/zephyr/log_dictionary.json")
+    parser.add_argument("--dump", metavar="FILE", help="also write the notifications to FILE")
+    parser.add_argument("--framed", action="store_true",
+                        help="decode ble_log_frame framing (backends that send it)")
+    parser.add_argument("--timeout", type=float, default=10.0, help="scan timeout (s)")
+    parser.add_argument("--debug", action="store_true", help="parser debug output")
+    args = parser.parse_args()
+
+    sink = DictionarySink(args.dictionary, args.debug) if args.dictionary else TextSink()
+    if args.framed:
+        sink = FrameDecoder(sink)
+    dump = open(args.dump, "wb") if args.dump else None  # pylint: disable=consider-using-with
+
+    def on_data(data: bytes):
+        if dump:
+            if args.framed:
+                dump.write(struct.pack("<H", len(data)))
+            dump.write(data)
+            dump.flush()
+        sink.feed(data)
+
+    try:
+        if args.replay:
+            with open(args.replay, "rb") as f:
+                data = f.read()
+            for frame in read_frames(data) if args.framed else [data]:
+                on_data(frame)
+        else:
+            asyncio.run(capture(args, on_data))
+    except KeyboardInterrupt:
+        pass
+    finally:
+        sink.close()
+        if dump:
+            dump.close()
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
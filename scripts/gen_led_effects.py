@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""Generate const led_effect tables from a YAML description at build time.
+
+Driven by CONFIG_NRFMODULE_LED_EFFECTS_FILE (see CMakeLists.txt). Every effect
+is range-checked here, so the firmware gets flash-resident tables with their
+step_end_ms running sums precomputed and nothing left to validate at runtime.
+
+Input:
+    effects:
+      charging:   { type: breathe, period_ms: 2000, color: [255, 128, 0] }
+      ble_blink:  { type: blink_n, count: 3, on_ms: 100, off_ms: 100,
+                    color: [0, 0, 255] }
+      custom:
+        loop: false
+        steps:
+          - { color: [255, 0, 0], substeps: 10, substep_ms: 20 }
+          - { color: [0, 0, 0],   substeps: 1,  substep_ms: 500 }
+
+Shorthand types mirror the LED_EFFECT_* macros in led_effect.h: solid, blink,
+breathe, flash, blink_n. Each effect `name` becomes `led_fx_<name>`.
+
+Usage:
+    python scripts/gen_led_effects.py effects.yaml --header out.h --source out.c
+"""
+
+import argparse
+import re
+import sys
+
+import yaml
+
+# Must match LED_BREATHE_SUBSTEPS in include/led/led_effect.h.
+BREATHE_SUBSTEPS = 24
+U16_MAX = 0xFFFF
+U32_MAX = 0xFFFFFFFF
+# lerp8() multiplies a channel delta (<=255) by the ms into a fade step in
+# int32, so a fading step must stay below INT32_MAX / 255 ms.
+FADE_STEP_MAX_MS = 0x7FFFFFFF // 255
+
+
+class EffectError(Exception):
+    pass
+
+
+def color(value, where):
+    if (not isinstance(value, (list, tuple)) or len(value) != 3 or
+            not all(isinstance(c, int) and 0 <= c <= 255 for c in value)):
+        raise EffectError(f"{where}: color must be [r, g, b] with 0..255 channels")
+    return tuple(value)
+
+
+def field(spec, key, where, lo=0, hi=U32_MAX):
+    if key not in spec:
+        raise EffectError(f"{where}: missing '{key}'")
+    value = spec[key]
+    if not isinstance(value, int) or not lo <= value <= hi:
+        raise EffectError(f"{where}: '{key}' must be an integer in {lo}..{hi}")
+    return value
+
+
+def expand(name, spec):
+    """Return (steps, loop) with steps as (color, substeps, substep_ms) tuples."""
+    where = f"effect '{name}'"
+    kind = spec.get("type", "steps")
+    black = (0, 0, 0)
+
+    if kind == "steps":
+        raw = spec.get("steps")
+        if not isinstance(raw, list) or not raw:
+            raise EffectError(f"{where}: 'steps' must be a non-empty list")
+        steps = []
+        for i, step in enumerate(raw):
+            at = f"{where} step {i}"
+            steps.append((color(step.get("color"), at),
+                          field(step, "substeps", at, 1, U16_MAX),
+                          field(step, "substep_ms", at, 0, U16_MAX)))
+        return steps, bool(spec.get("loop", True))
+
+    c = color(spec.get("color"), where)
+    if kind == "solid":
+        return [(c, 1, 1000)], True
+    if kind == "blink":
+        half = field(spec, "period_ms", where, 2) // 2
+        return [(c, 1, half), (black, 1, half)], True
+    if kind == "breathe":
+        sub = field(spec, "period_ms", where, 2 * BREATHE_SUBSTEPS) // 2 // BREATHE_SUBSTEPS
+        return [(c, BREATHE_SUBSTEPS, sub), (black, BREATHE_SUBSTEPS, sub)], True
+    if kind == "flash":
+        on = field(spec, "on_ms", where, 1)
+        period = field(spec, "period_ms", where, on)
+        return [(c, 1, on), (black, 1, period - on)], True
+    if kind == "blink_n":
+        count = field(spec, "count", where, 1, U16_MAX // 2)
+        on = field(spec, "on_ms", where, 1)
+        off = field(spec, "off_ms", where, 0)
+        return [(c, 1, on), (black, 1, off)] * count, False
+
+    raise EffectError(f"{where}: unknown type '{kind}'")
+
+
+def check(name, steps):
+    where = f"effect '{name}'"
+    # led_effect.step_count is a uint16_t.
+    if len(steps) > U16_MAX:
+        raise EffectError(f"{where}: {len(steps)} steps exceed 16 bits")
+    total = 0
+    for i, (_, substeps, substep_ms) in enumerate(steps):
+        for key, value in (("substep_ms", substep_ms), ("substeps", substeps)):
+            if value > U16_MAX:
+                raise EffectError(f"{where} step {i}: {key} {value} exceeds 16 bits")
+        dur = substeps * substep_ms
+        if substeps > 1 and dur >= FADE_STEP_MAX_MS:
+            raise EffectError(f"{where} step {i}: fade of {dur} ms overflows the "
+                              f"interpolation (max {FADE_STEP_MAX_MS - 1} ms)")
+        total += dur
+    if total == 0:
+        raise EffectError(f"{where}: total duration is 0 ms")
+    if total > U32_MAX:
+        raise EffectError(f"{where}: total duration {total} ms exceeds 32 bits")
+
+
+def running_sums(steps):
+    ends, acc = [], 0
+    for _, substeps, substep_ms in steps:
+        acc += substeps * substep_ms
+        ends.append(acc)
+    return ends
+
+
+def generate(doc, header_name):
+    effects = (doc or {}).get("effects")
+    if not isinstance(effects, dict) or not effects:
+        raise EffectError("top-level 'effects' mapping is missing or empty")
+
+    decls, tables, defs = [], [], []
+    # Identical step/sum tables are emitted once and shared between effects.
+    step_tables, end_tables = {}, {}
+
+    for name, spec in effects.items():
+        if not re.fullmatch(r"[A-Za-z_][A-Za-z0-9_]*", str(name)):
+            raise EffectError(f"effect name '{name}' is not a C identifier")
+        if not isinstance(spec, dict):
+            raise EffectError(f"effect '{name}' must be a mapping")
+        steps, loop = expand(name, spec)
+        check(name, steps)
+
+        key = tuple(steps)
+        if key not in step_tables:
+            step_tables[key] = f"led_fx_steps_{len(step_tables)}"
+            rows = "".join(f"\t{{ LED_RGB({c[0]}, {c[1]}, {c[2]}), {n}, {ms} }},\n"
+                           for c, n, ms in steps)
+            tables.append(f"static const struct led_effect_step {step_tables[key]}[] = {{\n"
+                          f"{rows}}};\n")
+        ends = tuple(running_sums(steps))
+        if ends not in end_tables:
+            end_tables[ends] = f"led_fx_ends_{len(end_tables)}"
+            rows = "".join(f"\t{e},\n" for e in ends)
+            tables.append(f"static const uint32_t {end_tables[ends]}[] = {{\n{rows}}};\n")
+
+        decls.append(f"extern const struct led_effect led_fx_{name};\n")
+        defs.append(f"const struct led_effect led_fx_{name} = {{\n"
+                    f"\t.steps = {step_tables[key]},\n"
+                    f"\t.step_count = {len(steps)},\n"
+                    f"\t.loop = {'true' if loop else 'false'},\n"
+                    f"\t.step_end_ms = {end_tables[ends]},\n"
+                    f"}};\n")
+
+    banner = "/* Generated by scripts/gen_led_effects.py. Do not edit. */\n"
+    guard = "LED_EFFECTS_GEN_H_"
+    header = (f"{banner}\n#ifndef {guard}\n#define {guard}\n\n"
+              f"#include <led/led_effect.h>\n\n{''.join(decls)}\n#endif /* {guard} */\n")
+    source = (f"{banner}\n#include <{header_name}>\n\n" + "\n".join(tables) + "\n" +
+              "\n".join(defs))
+    return header, source
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate LED effect tables")
+    parser.add_argument("input", help="YAML effect definitions")
+    parser.add_argument("--header", required=True, help="Output header path")
+    parser.add_argument("--source", required=True, help="Output C source path")
+    parser.add_argument("--include-name", default="led/led_effects_gen.h",
+                        help="How the source #includes the header")
+    args = parser.parse_args()
+
+    try:
+        with open(args.input, "r") as f:
+            doc = yaml.safe_load(f)
+        header, source = generate(doc, args.include_name)
+    except (OSError, yaml.YAMLError, EffectError) as e:
+        print(f"[gen_led_effects] {args.input}: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    with open(args.header, "w") as f:
+        f.write(header)
+    with open(args.source, "w") as f:
+        f.write(source)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,10 +1,12 @@
 #!/usr/bin/env python3
-"""Run a Zephyr ztest suite on qemu_cortex_m0 with timeout and clean output.
+"""Run a Zephyr ztest suite on QEMU (qemu_cortex_m0 by default) with timeout and clean output.
 
 Usage:
     python scripts/run_test.py tests/led_effect
     python scripts/run_test.py tests/led_arbiter --pristine
     python scripts/run_test.py tests/led_effect --timeout 60
+    python scripts/run_test.py tests/led_bench --timeout 120
+    python scripts/run_test.py tests/bmp390_comp --board mps3/corstone300/an547 -- -DCONFIG_FPU=y
 """
 
 import argparse
@@ -30,16 +32,18 @@ def kill_tree(pid):
         pass
 
 
-def run(test_dir: str, pristine: bool, timeout: int) -> int:
+def run(test_dir: str, pristine: bool, timeout: int, board: str, extra: list) -> int:
     build_cmd = [
         "west", "build",
-        "-b", DEFAULT_BOARD,
+        "-b", board,
         test_dir,
         "--build-dir", BUILD_DIR,
         "--no-sysbuild",
     ]
     if pristine:
         build_cmd.append("--pristine")
+    if extra:
+        build_cmd += ["--"] + extra
 
     # --- Build ---
     print(f"[build] {' '.join(build_cmd)}")
@@ -97,6 +101,9 @@ def run(test_dir: str, pristine: bool, timeout: int) -> int:
     for line in output.splitlines():
         if re.match(r"\s*(PASS|FAIL|SKIP)\s*-\s*", line):
             print(line.strip())
+        elif re.match(r"\s*(BENCH|TICKS),", line):
+            # machine-readable benchmark rows (tests/led_bench, tests/bmp390_comp)
+            print(line.strip())
         elif "ASSERTION FAIL" in line or "Assertion failed" in line:
             print(line.strip())
 
@@ -122,6 +129,10 @@ def main():
     parser.add_argument("--pristine", action="store_true", help="Clean rebuild")
     parser.add_argument("--timeout", type=int, default=DEFAULT_TIMEOUT,
                         help=f"QEMU timeout in seconds (default: {DEFAULT_TIMEOUT})")
+    parser.add_argument("--board", default=DEFAULT_BOARD,
+                        help=f"QEMU board (default: {DEFAULT_BOARD})")
+    parser.add_argument("cmake_args", nargs="*",
+                        help="Extra CMake arguments after --, e.g. -DCONFIG_FPU=y")
     args = parser.parse_args()
 
     # west needs to run from inside the workspace; test paths are relative to project root
@@ -133,7 +144,7 @@ def main():
         print(f"[error] Test directory not found: {args.test_dir}")
         sys.exit(1)
 
-    sys.exit(run(args.test_dir, args.pristine, args.timeout))
+    sys.exit(run(args.test_dir, args.pristine, args.timeout, args.board, args.cmake_args))
 
 
 if __name__ == "__main__":
@@ -0,0 +1,114 @@
+/* Generated by scripts/gen_led_effects.py. Do not edit. */
+
+#include <led/led_effects_gen.h>
+
+static const struct led_effect_step led_fx_steps_0[] = {
+	{ LED_RGB(255, 128, 0), 24, 41 },
+	{ LED_RGB(0, 0, 0), 24, 41 },
+};
+
+static const uint32_t led_fx_ends_0[] = {
+	984,
+	1968,
+};
+
+static const struct led_effect_step led_fx_steps_1[] = {
+	{ LED_RGB(0, 0, 255), 1, 100 },
+	{ LED_RGB(0, 0, 0), 1, 100 },
+	{ LED_RGB(0, 0, 255), 1, 100 },
+	{ LED_RGB(0, 0, 0), 1, 100 },
+};
+
+static const uint32_t led_fx_ends_1[] = {
+	100,
+	200,
+	300,
+	400,
+};
+
+static const struct led_effect_step led_fx_steps_2[] = {
+	{ LED_RGB(255, 0, 0), 1, 100 },
+	{ LED_RGB(0, 0, 0), 1, 100 },
+};
+
+static const uint32_t led_fx_ends_2[] = {
+	100,
+	200,
+};
+
+static const struct led_effect_step led_fx_steps_3[] = {
+	{ LED_RGB(255, 255, 255), 1, 50 },
+	{ LED_RGB(0, 0, 0), 1, 950 },
+};
+
+static const uint32_t led_fx_ends_3[] = {
+	50,
+	1000,
+};
+
+static const struct led_effect_step led_fx_steps_4[] = {
+	{ LED_RGB(0, 16, 0), 1, 1000 },
+};
+
+static const uint32_t led_fx_ends_4[] = {
+	1000,
+};
+
+static const struct led_effect_step led_fx_steps_5[] = {
+	{ LED_RGB(255, 0, 0), 10, 20 },
+	{ LED_RGB(0, 0, 0), 1, 500 },
+};
+
+static const uint32_t led_fx_ends_5[] = {
+	200,
+	700,
+};
+
+const struct led_effect led_fx_charging = {
+	.steps = led_fx_steps_0,
+	.step_count = 2,
+	.loop = true,
+	.step_end_ms = led_fx_ends_0,
+};
+
+const struct led_effect led_fx_ble_blink = {
+	.steps = led_fx_steps_1,
+	.step_count = 4,
+	.loop = false,
+	.step_end_ms = led_fx_ends_1,
+};
+
+const struct led_effect led_fx_blink_a = {
+	.steps = led_fx_steps_2,
+	.step_count = 2,
+	.loop = true,
+	.step_end_ms = led_fx_ends_2,
+};
+
+const struct led_effect led_fx_blink_b = {
+	.steps = led_fx_steps_2,
+	.step_count = 2,
+	.loop = true,
+	.step_end_ms = led_fx_ends_2,
+};
+
+const struct led_effect led_fx_alert = {
+	.steps = led_fx_steps_3,
+	.step_count = 2,
+	.loop = true,
+	.step_end_ms = led_fx_ends_3,
+};
+
+const struct led_effect led_fx_idle = {
+	.steps = led_fx_steps_4,
+	.step_count = 1,
+	.loop = true,
+	.step_end_ms = led_fx_ends_4,
+};
+
+const struct led_effect led_fx_custom = {
+	.steps = led_fx_steps_5,
+	.step_count = 2,
+	.loop = false,
+	.step_end_ms = led_fx_ends_5,
+};
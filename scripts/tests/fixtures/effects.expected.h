@@ -0,0 +1,16 @@
+/* Generated by scripts/gen_led_effects.py. Do not edit. */
+
+#ifndef LED_EFFECTS_GEN_H_
+#define LED_EFFECTS_GEN_H_
+
+#include <led/led_effect.h>
+
+extern const struct led_effect led_fx_charging;
+extern const struct led_effect led_fx_ble_blink;
+extern const struct led_effect led_fx_blink_a;
+extern const struct led_effect led_fx_blink_b;
+extern const struct led_effect led_fx_alert;
+extern const struct led_effect led_fx_idle;
+extern const struct led_effect led_fx_custom;
+
+#endif /* LED_EFFECTS_GEN_H_ */
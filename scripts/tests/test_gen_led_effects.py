@@ -0,0 +1,82 @@
+"""Tests for scripts/gen_led_effects.py.
+
+fixtures/effects.yaml must generate fixtures/effects.expected.{h,c} byte for
+byte; the error cases must be refused with EffectError before any table is
+emitted.
+
+Usage:
+    python -m pytest scripts/tests
+"""
+
+import pathlib
+import subprocess
+import sys
+
+import pytest
+import yaml
+
+SCRIPTS = pathlib.Path(__file__).resolve().parent.parent
+FIXTURES = pathlib.Path(__file__).resolve().parent / "fixtures"
+sys.path.insert(0, str(SCRIPTS))
+
+import gen_led_effects as gen  # noqa: E402
+
+
+def test_fixture_matches_expected(tmp_path):
+    header, source = tmp_path / "out.h", tmp_path / "out.c"
+    subprocess.run([sys.executable, str(SCRIPTS / "gen_led_effects.py"),
+                    str(FIXTURES / "effects.yaml"),
+                    "--header", str(header), "--source", str(source)], check=True)
+    assert header.read_text() == (FIXTURES / "effects.expected.h").read_text()
+    assert source.read_text() == (FIXTURES / "effects.expected.c").read_text()
+
+
+def test_step_count_limit():
+    step = {"color": [1, 2, 3], "substeps": 1, "substep_ms": 1}
+    doc = {"effects": {"long": {"steps": [step] * gen.U16_MAX}}}
+    header, source = gen.generate(doc, "out.h")
+    assert f".step_count = {gen.U16_MAX}," in source
+
+    doc["effects"]["long"]["steps"].append(step)
+    with pytest.raises(gen.EffectError, match="65536 steps exceed 16 bits"):
+        gen.generate(doc, "out.h")
+
+
+@pytest.mark.parametrize("text, match", [
+    ("effects: {}", "'effects' mapping is missing or empty"),
+    ("effects: { 1x: { type: solid, color: [0, 0, 0] } }", "not a C identifier"),
+    ("effects: { a: solid }", "must be a mapping"),
+    ("effects: { a: { type: glow, color: [0, 0, 0] } }", "unknown type 'glow'"),
+    ("effects: { a: { type: solid, color: [0, 0, 256] } }", "color must be"),
+    ("effects: { a: { type: blink, color: [0, 0, 0] } }", "missing 'period_ms'"),
+    ("effects: { a: { type: flash, on_ms: 500, period_ms: 100, color: [0, 0, 0] } }",
+     "'period_ms' must be an integer in 500.."),
+    ("effects: { a: { type: blink_n, count: 32768, on_ms: 1, off_ms: 1,"
+     " color: [0, 0, 0] } }", "'count' must be an integer in 1..32767"),
+    ("effects: { a: { steps: [] } }", "'steps' must be a non-empty list"),
+    ("effects: { a: { steps: [{ color: [0, 0, 0], substeps: 0, substep_ms: 1 }] } }",
+     "step 0: 'substeps' must be an integer in 1..65535"),
+    ("effects: { a: { steps: [{ color: [0, 0, 0], substeps: 1, substep_ms: 65536 }] } }",
+     "step 0: 'substep_ms' must be an integer in 0..65535"),
+    ("effects: { a: { steps: [{ color: [0, 0, 0], substeps: 1, substep_ms: 0 }] } }",
+     "total duration is 0 ms"),
+    ("effects: { a: { steps: [{ color: [0, 0, 0], substeps: 65535, substep_ms: 65535 }] } }",
+     "fade of 4294836225 ms overflows"),
+    ("effects: { a: { type: blink, period_ms: 200000, color: [0, 0, 0] } }",
+     "substep_ms 100000 exceeds 16 bits"),
+])
+def test_rejects(text, match):
+    with pytest.raises(gen.EffectError, match=match):
+        gen.generate(yaml.safe_load(text), "out.h")
+
+
+def test_cli_reports_errors(tmp_path):
+    bad = tmp_path / "bad.yaml"
+    bad.write_text("effects: { a: { type: glow, color: [0, 0, 0] } }\n")
+    result = subprocess.run([sys.executable, str(SCRIPTS / "gen_led_effects.py"), str(bad),
+                             "--header", str(tmp_path / "out.h"),
+                             "--source", str(tmp_path / "out.c")],
+                            capture_output=True, text=True)
+    assert result.returncode == 1
+    assert "[gen_led_effects]" in result.stderr and "unknown type" in result.stderr
+    assert not (tmp_path / "out.h").exists()
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Pressure altitude against the powf() ISA formula, the alpha-beta filter on
+ * synthetic climbs, plus per-sample cost as BENCH rows (see tests/led_bench):
+ *
+ *   BENCH,<function>,<variant>,<param>,<ns_per_call>
+ */
+
+#include <zephyr/ztest.h>
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <baro/baro_alt.h>
+
+#define ITERATIONS (500)
+#define DT_MS      (40)   /* 25 Hz */
+
+static volatile int32_t sink; /* keeps results live */
+
+static float alt_ref_mm(uint32_t press_cpa, uint32_t p0_cpa)
+{
+	return 44330.77f * (1.0f - powf((float)press_cpa / (float)p0_cpa, 0.190263f)) * 1000.0f;
+}
+
+/* Deterministic noise, uniform in +-amp_mm. */
+static int32_t noise_mm(uint32_t *state, int32_t amp_mm)
+{
+	*state = *state * 1664525U + 1013904223U;
+	return (int32_t)((*state >> 16) % (uint32_t)(2 * amp_mm + 1)) - amp_mm;
+}
+
+ZTEST_SUITE(baro_alt, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(baro_alt, test_alt_matches_formula)
+{
+	static const uint32_t p0s[] = { 9800000, BARO_ALT_P0_STD_CPA, 10300000 };
+	float max_err = 0.0f;
+
+	for (size_t i = 0; i < ARRAY_SIZE(p0s); i++) {
+		for (uint32_t p = 3000000; p <= 11000000; p += 9973) {
+			const float err = fabsf((float)baro_alt_mm(p, p0s[i]) -
+						alt_ref_mm(p, p0s[i]));
+
+			max_err = MAX(max_err, err);
+		}
+	}
+
+	TC_PRINT("max |dh| = %d mm over 30..110 kPa\n", (int)max_err);
+	zassert_true(max_err < 150.0f, "altitude within 0.15 m of the formula");
+}
+
+ZTEST(baro_alt, test_alt_reference_and_clamp)
+{
+	int32_t prev = INT32_MAX;
+
+	zassert_equal(baro_alt_mm(BARO_ALT_P0_STD_CPA, BARO_ALT_P0_STD_CPA), 0);
+	zassert_equal(baro_alt_mm(9500000, 0), 0, "no reference, no altitude");
+
+	/* Monotonic: more pressure, lower altitude. */
+	for (uint32_t p = 2000000; p <= 13000000; p += 1000) {
+		const int32_t h = baro_alt_mm(p, BARO_ALT_P0_STD_CPA);
+
+		zassert_true(h <= prev, "monotonic at %u cPa", p);
+		prev = h;
+	}
+
+	/* Out of table range clamps instead of extrapolating. */
+	zassert_equal(baro_alt_mm(0, BARO_ALT_P0_STD_CPA),
+		      baro_alt_mm(2000000, BARO_ALT_P0_STD_CPA));
+}
+
+ZTEST(baro_alt, test_gains_match_kalata)
+{
+	static const struct {
+		uint32_t meas_mm;
+		uint32_t accel_mm_s2;
+		uint32_t dt_ms;
+	} cases[] = {
+		{ 100, 100, 40 }, { 300, 500, 40 }, { 50, 2000, 100 }, { 1000, 10, 20 },
+	};
+	struct baro_alt_filter_cfg cfg;
+
+	zassert_equal(baro_alt_filter_gains(&cfg, 0, 100, 40), -EINVAL);
+	zassert_equal(baro_alt_filter_gains(&cfg, 100, 100, 0), -EINVAL);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		const float dt = cases[i].dt_ms / 1000.0f;
+		const float lambda = cases[i].accel_mm_s2 * dt * dt / cases[i].meas_mm;
+		const float r = (4.0f + lambda - sqrtf(8.0f * lambda + lambda * lambda)) / 4.0f;
+		const float alpha = 1.0f - r * r;
+		const float beta = 2.0f * (1.0f - r) * (1.0f - r);
+
+		zassert_ok(baro_alt_filter_gains(&cfg, cases[i].meas_mm,
+						 cases[i].accel_mm_s2, cases[i].dt_ms));
+		zassert_within(cfg.alpha / 65536.0f, alpha, 0.002f, "alpha case %u", (unsigned int)i);
+		zassert_within(cfg.beta / 65536.0f, beta, 0.002f, "beta case %u", (unsigned int)i);
+	}
+}
+
+ZTEST(baro_alt, test_filter_tracks_climb)
+{
+	struct baro_alt_filter_cfg cfg;
+	struct baro_alt_filter f;
+	uint32_t seed = 1;
+	int64_t sq_raw = 0;
+	int64_t sq_flt = 0;
+	int32_t truth = 0;
+
+	zassert_ok(baro_alt_filter_gains(&cfg, 300, 200, DT_MS));
+	baro_alt_filter_init(&f, &cfg);
+
+	/* 2 m/s climb with +-0.5 m of noise for 30 s. */
+	for (int i = 0; i < 750; i++) {
+		const int32_t z = truth + noise_mm(&seed, 500);
+
+		baro_alt_filter_update(&f, z, 0, DT_MS);
+		if (i >= 500) {
+			const int32_t e = baro_alt_filter_alt_mm(&f) - truth;
+
+			sq_raw += (int64_t)(z - truth) * (z - truth);
+			sq_flt += (int64_t)e * e;
+		}
+		truth += 2000 * DT_MS / 1000;
+	}
+
+	zassert_within(baro_alt_filter_vspeed_mm_s(&f), 2000, 200, "vspeed %d mm/s",
+		       baro_alt_filter_vspeed_mm_s(&f));
+	zassert_true(sq_flt * 2 < sq_raw, "filter at least halves the noise power");
+}
+
+ZTEST(baro_alt, test_accel_shortens_lag)
+{
+	struct baro_alt_filter_cfg cfg;
+	struct baro_alt_filter baro_only;
+	struct baro_alt_filter fused;
+	int32_t truth = 0;
+	int32_t vs = 0;
+
+	zassert_ok(baro_alt_filter_gains(&cfg, 300, 200, DT_MS));
+	baro_alt_filter_init(&baro_only, &cfg);
+	baro_alt_filter_init(&fused, &cfg);
+
+	/* Level for 4 s, then 1 m/s^2 up for 1 s. */
+	for (int i = 0; i < 125; i++) {
+		const int32_t accel = (i >= 100) ? 1000 : 0;
+
+		baro_alt_filter_update(&baro_only, truth, 0, DT_MS);
+		baro_alt_filter_update(&fused, truth, accel, DT_MS);
+
+		truth += vs * DT_MS / 1000 + accel * DT_MS * DT_MS / 2000000;
+		vs += accel * DT_MS / 1000;
+	}
+
+	TC_PRINT("vspeed after 1 s at 1 m/s^2: baro %d, fused %d mm/s\n",
+		 baro_alt_filter_vspeed_mm_s(&baro_only),
+		 baro_alt_filter_vspeed_mm_s(&fused));
+	zassert_true(abs(baro_alt_filter_vspeed_mm_s(&fused) - 1000) <
+		     abs(baro_alt_filter_vspeed_mm_s(&baro_only) - 1000) / 4,
+		     "accelerometer removes most of the lag");
+}
+
+ZTEST(baro_alt, test_bench)
+{
+	struct baro_alt_filter_cfg cfg = { .alpha = 6554, .beta = 328 };
+	struct baro_alt_filter f;
+	uint32_t start;
+	uint32_t ns;
+
+	TC_PRINT("BENCH,function,variant,param,ns_per_call\n");
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		sink += (int32_t)alt_ref_mm(9000000 + i * 131U, BARO_ALT_P0_STD_CPA);
+	}
+	ns = (uint32_t)(k_cyc_to_ns_floor64(k_cycle_get_32() - start) / ITERATIONS);
+	TC_PRINT("BENCH,baro_alt,powf,-,%u\n", ns);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		sink += baro_alt_mm(9000000 + i * 131U, BARO_ALT_P0_STD_CPA);
+	}
+	ns = (uint32_t)(k_cyc_to_ns_floor64(k_cycle_get_32() - start) / ITERATIONS);
+	TC_PRINT("BENCH,baro_alt,table,-,%u\n", ns);
+
+	baro_alt_filter_init(&f, &cfg);
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		baro_alt_filter_update(&f, (int32_t)(i * 80U), 0, DT_MS);
+	}
+	ns = (uint32_t)(k_cyc_to_ns_floor64(k_cycle_get_32() - start) / ITERATIONS);
+	sink += baro_alt_filter_alt_mm(&f);
+	TC_PRINT("BENCH,baro_alt_filter_update,-,-,%u\n", ns);
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <power/batt_soc.h>
+
+ZTEST_SUITE(batt_soc, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(batt_soc, test_curve_points)
+{
+	for (size_t i = 0; i < batt_soc_lipo_len; i++) {
+		zassert_equal(batt_soc_from_mv(batt_soc_lipo, batt_soc_lipo_len,
+					       batt_soc_lipo[i].mv),
+			      batt_soc_lipo[i].pct, "point %zu", i);
+	}
+}
+
+ZTEST(batt_soc, test_curve_interpolates)
+{
+	/* Halfway between 3800 (58) and 3750 (48). */
+	zassert_equal(batt_soc_from_mv(batt_soc_lipo, batt_soc_lipo_len, 3775), 53);
+	zassert_equal(batt_soc_from_mv(batt_soc_lipo, batt_soc_lipo_len, 4150), 96);
+}
+
+ZTEST(batt_soc, test_curve_clamps)
+{
+	zassert_equal(batt_soc_from_mv(batt_soc_lipo, batt_soc_lipo_len, 4350), 100,
+		      "charging overshoot");
+	zassert_equal(batt_soc_from_mv(batt_soc_lipo, batt_soc_lipo_len, 3000), 0);
+	zassert_equal(batt_soc_from_mv(batt_soc_lipo, batt_soc_lipo_len, 0), 0);
+	zassert_equal(batt_soc_from_mv(batt_soc_lipo, 0, 3800), 0, "empty curve");
+}
+
+ZTEST(batt_soc, test_curve_monotonic)
+{
+	uint8_t prev = 0;
+
+	for (uint16_t mv = 3000; mv <= 4400; mv++) {
+		const uint8_t pct = batt_soc_from_mv(batt_soc_lipo, batt_soc_lipo_len, mv);
+
+		zassert_true(pct >= prev, "%u mV", mv);
+		prev = pct;
+	}
+}
+
+ZTEST(batt_soc, test_filter_seeds)
+{
+	struct batt_filter f;
+
+	batt_filter_init(&f, 3);
+	zassert_equal(batt_filter_update(&f, 3912), 3912, "first sample taken as is");
+}
+
+ZTEST(batt_soc, test_filter_smooths)
+{
+	struct batt_filter f;
+	uint16_t mv;
+
+	batt_filter_init(&f, 2);
+	(void)batt_filter_update(&f, 4000);
+
+	mv = batt_filter_update(&f, 3600);
+	zassert_equal(mv, 3900, "a quarter of the step");
+
+	for (int i = 0; i < 40; i++) {
+		mv = batt_filter_update(&f, 3600);
+	}
+	zassert_equal(mv, 3600, "settles on the input");
+
+	for (int i = 0; i < 40; i++) {
+		mv = batt_filter_update(&f, 4100);
+	}
+	zassert_equal(mv, 4100, "and upwards");
+}
+
+ZTEST(batt_soc, test_filter_passthrough)
+{
+	struct batt_filter f;
+
+	batt_filter_init(&f, 0);
+	(void)batt_filter_update(&f, 4000);
+	zassert_equal(batt_filter_update(&f, 3500), 3500);
+	zassert_equal(batt_filter_update(&f, 65535), 65535, "no overflow at full scale");
+}
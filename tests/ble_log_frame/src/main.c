@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+#include <ble_log/ble_log_frame.h>
+
+#define MAX_FRAMES (64)
+
+static uint8_t frames[MAX_FRAMES][BLE_LOG_FRAME_MAX];
+static size_t frame_len[MAX_FRAMES];
+static size_t frame_count;
+static int emit_err;
+
+static int emit(const uint8_t *frame, size_t len, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	if (emit_err) {
+		return emit_err;
+	}
+	if (frame_count == MAX_FRAMES) {
+		return -ENOSPC;
+	}
+	memcpy(frames[frame_count], frame, len);
+	frame_len[frame_count++] = len;
+
+	return 0;
+}
+
+static struct ble_log_packer p;
+
+static void reset(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	frame_count = 0;
+	emit_err = 0;
+	ble_log_packer_init(&p, emit, NULL);
+	ble_log_packer_set_mtu(&p, 247);
+}
+
+static void put_str(const char *s)
+{
+	ble_log_packer_put(&p, (const uint8_t *)s, strlen(s));
+}
+
+static uint16_t seq_of(size_t i)
+{
+	return frames[i][2] | (frames[i][3] << 8);
+}
+
+ZTEST_SUITE(ble_log_frame, NULL, NULL, reset, NULL, NULL);
+
+ZTEST(ble_log_frame, test_packs_messages)
+{
+	put_str("<inf> app: one\n");
+	put_str("<inf> app: two\n");
+	put_str("<wrn> app: three\n");
+	zassert_equal(frame_count, 0, "nothing sent until full or flushed");
+
+	zassert_ok(ble_log_packer_flush(&p));
+	zassert_equal(frame_count, 1);
+	zassert_equal(frames[0][0] >> 4, BLE_LOG_FRAME_VERSION);
+	zassert_equal(frames[0][1], 0, "first message at offset 0");
+	zassert_equal(seq_of(0), 0);
+	zassert_equal(frame_len[0], BLE_LOG_FRAME_HDR_SIZE + 15 + 15 + 17);
+	zassert_mem_equal(&frames[0][BLE_LOG_FRAME_HDR_SIZE], "<inf> app: one\n", 15);
+
+	zassert_ok(ble_log_packer_flush(&p));
+	zassert_equal(frame_count, 1, "empty flush sends nothing");
+}
+
+ZTEST(ble_log_frame, test_whole_message_moves_to_next_frame)
+{
+	uint8_t msg[100];
+
+	memset(msg, 'a', sizeof(msg));
+	ble_log_packer_put(&p, msg, sizeof(msg));
+	ble_log_packer_put(&p, msg, sizeof(msg));
+	ble_log_packer_put(&p, msg, sizeof(msg)); /* 4 + 300 > 244 */
+	zassert_equal(frame_count, 1, "first frame sent short");
+	zassert_equal(frame_len[0], BLE_LOG_FRAME_HDR_SIZE + 200);
+
+	(void)ble_log_packer_flush(&p);
+	zassert_equal(frames[1][1], 0, "third message starts the next frame");
+	zassert_equal(seq_of(1), 1);
+}
+
+ZTEST(ble_log_frame, test_oversize_message_splits)
+{
+	uint8_t big[500];
+
+	for (size_t i = 0; i < sizeof(big); i++) {
+		big[i] = (uint8_t)i;
+	}
+
+	put_str("hi\n");
+	ble_log_packer_put(&p, big, sizeof(big));
+	put_str("after\n");
+	(void)ble_log_packer_flush(&p);
+
+	/* 3 + 500 + 6 bytes over 240-byte payloads. */
+	zassert_equal(frame_count, 3);
+	zassert_equal(frames[0][1], 0);
+	zassert_equal(frames[1][1], BLE_LOG_FRAME_NO_START, "middle of the big message");
+	zassert_equal(frames[2][1], 503 - 480, "'after' starts after the tail");
+	zassert_mem_equal(&frames[2][BLE_LOG_FRAME_HDR_SIZE + frames[2][1]], "after\n", 6);
+}
+
+ZTEST(ble_log_frame, test_mtu_limits)
+{
+	ble_log_packer_set_mtu(&p, 23);
+	zassert_equal(p.cap, BLE_LOG_FRAME_MIN);
+	ble_log_packer_set_mtu(&p, 0);
+	zassert_equal(p.cap, BLE_LOG_FRAME_MIN, "never below the default MTU");
+	ble_log_packer_set_mtu(&p, 517);
+	zassert_equal(p.cap, BLE_LOG_FRAME_MAX);
+
+	put_str("0123456789012345678901234567890123456789");
+	zassert_equal(frame_count, 0);
+	ble_log_packer_set_mtu(&p, 23);
+	zassert_equal(frame_count, 1, "open frame too big for the new MTU");
+}
+
+ZTEST(ble_log_frame, test_drop_keeps_seq)
+{
+	put_str("lost\n");
+	emit_err = -ENOMEM;
+	zassert_equal(ble_log_packer_flush(&p), -ENOMEM);
+	zassert_equal(p.dropped, 1);
+
+	emit_err = 0;
+	put_str("kept\n");
+	(void)ble_log_packer_flush(&p);
+	zassert_equal(frame_count, 1);
+	zassert_equal(seq_of(0), 1, "host sees seq 0 missing");
+}
+
+ZTEST(ble_log_frame, test_flags_split_frames)
+{
+	put_str("live\n");
+	ble_log_packer_set_flags(&p, BLE_LOG_FRAME_F_STORED);
+	zassert_equal(frame_count, 1, "flag change closes the open frame");
+	put_str("stored\n");
+	ble_log_packer_set_flags(&p, BLE_LOG_FRAME_F_STORED);
+	zassert_equal(frame_count, 1, "same flags keep packing");
+	put_str("stored\n");
+	ble_log_packer_set_flags(&p, 0);
+	zassert_equal(frame_count, 2);
+
+	zassert_equal(frames[0][0], BLE_LOG_FRAME_FLAGS(0));
+	zassert_equal(frames[1][0], BLE_LOG_FRAME_FLAGS(BLE_LOG_FRAME_F_STORED));
+	zassert_equal(frame_len[1], BLE_LOG_FRAME_HDR_SIZE + 14);
+}
+
+ZTEST(ble_log_frame, test_drop_report_alone)
+{
+	const uint8_t report[16] = { 3, 0, 0, 0 };
+
+	put_str("before\n");
+	ble_log_packer_put_drops(&p, report, sizeof(report));
+	put_str("after\n");
+	(void)ble_log_packer_flush(&p);
+
+	zassert_equal(frame_count, 3);
+	zassert_equal(frames[1][0], BLE_LOG_FRAME_FLAGS(BLE_LOG_FRAME_F_DROPS));
+	zassert_equal(frame_len[1], BLE_LOG_FRAME_HDR_SIZE + sizeof(report));
+	zassert_equal(frames[2][0], BLE_LOG_FRAME_FLAGS(0), "flags restored");
+}
+
+ZTEST(ble_log_frame, test_reassembles)
+{
+	static uint8_t sent[4096];
+	static uint8_t got[4096];
+	size_t sent_len = 0;
+	size_t got_len = 0;
+	uint32_t rnd = 12345;
+
+	ble_log_packer_set_mtu(&p, 185); /* iOS default */
+
+	while (sent_len < 3000) {
+		uint8_t msg[300];
+		size_t n;
+
+		rnd = rnd * 1103515245U + 12345U;
+		n = 1 + (rnd >> 16) % sizeof(msg);
+		for (size_t i = 0; i < n; i++) {
+			msg[i] = (uint8_t)(sent_len + i);
+		}
+		ble_log_packer_put(&p, msg, n);
+		memcpy(&sent[sent_len], msg, n);
+		sent_len += n;
+	}
+	(void)ble_log_packer_flush(&p);
+
+	for (size_t f = 0; f < frame_count; f++) {
+		zassert_true(frame_len[f] <= 182);
+		zassert_equal(seq_of(f), f);
+		memcpy(&got[got_len], &frames[f][BLE_LOG_FRAME_HDR_SIZE],
+		       frame_len[f] - BLE_LOG_FRAME_HDR_SIZE);
+		got_len += frame_len[f] - BLE_LOG_FRAME_HDR_SIZE;
+	}
+	zassert_equal(got_len, sent_len);
+	zassert_mem_equal(got, sent, sent_len);
+}
+
+ZTEST(ble_log_frame, test_notifications_saved)
+{
+	/* 100 typical text lines of 30..60 bytes at the usual 247-byte MTU. */
+	static const char *const lines[] = {
+		"[00:00:12.345,000] <inf> app: fix ok\n",
+		"[00:00:12.346,000] <dbg> bmp390: p=101325 t=2150\n",
+		"[00:00:12.350,000] <wrn> lte: rsrp -112\n",
+	};
+
+	for (int i = 0; i < 100; i++) {
+		put_str(lines[i % ARRAY_SIZE(lines)]);
+	}
+	(void)ble_log_packer_flush(&p);
+
+	TC_PRINT("FRAMES,mtu247,msgs=100,%zu\n", frame_count);
+	zassert_true(frame_count <= 100 / 4, "at least four lines per notification");
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Per-frame LZ for BLE log frames: round trips, limits, frame independence,
+ * plus machine-readable numbers:
+ *
+ *   RATIO,<corpus>,<raw_bytes>,<plain_frames>,<lz_frames>
+ *   BENCH,<function>,<variant>,<param>,<ns_per_call>
+ *
+ * With the board's icount settings, ns is deterministic under QEMU.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <ble_log/ble_log_frame.h>
+#include <ble_log/ble_log_lz.h>
+
+#define MAX_FRAMES (256)
+#define LINES      (100)
+
+static struct ble_log_lz lz;
+static uint8_t out[2048];
+static uint8_t dec[2048];
+
+static uint8_t frames[MAX_FRAMES][BLE_LOG_FRAME_MAX];
+static size_t frame_len[MAX_FRAMES];
+static size_t frame_count;
+
+static char corpus[LINES][96];
+static size_t corpus_len[LINES];
+
+static int emit(const uint8_t *frame, size_t len, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	if (frame_count == MAX_FRAMES) {
+		return -ENOSPC;
+	}
+	memcpy(frames[frame_count], frame, len);
+	frame_len[frame_count++] = len;
+
+	return 0;
+}
+
+/* Text log lines as the BLE backend formats them. */
+static void build_corpus(void)
+{
+	static const char *const fmt[] = {
+		"[%02u:%02u:%02u.%03u,000] <inf> app: fix ok sats=%u\r\n",
+		"[%02u:%02u:%02u.%03u,000] <dbg> bmp390: p=%u t=2150\r\n",
+		"[%02u:%02u:%02u.%03u,000] <wrn> lte: rsrp -%u\r\n",
+		"[%02u:%02u:%02u.%03u,000] <inf> batt_mon: %u mV 87%%\r\n",
+	};
+	uint32_t ms = 12345;
+
+	for (int i = 0; i < LINES; i++) {
+		ms += 37 + (i * 101) % 250;
+		corpus_len[i] = snprintf(corpus[i], sizeof(corpus[i]), fmt[i % ARRAY_SIZE(fmt)],
+					 ms / 3600000, (ms / 60000) % 60, (ms / 1000) % 60,
+					 ms % 1000, 3700 + (i * 13) % 500);
+	}
+}
+
+static size_t pack_corpus(struct ble_log_lz *with)
+{
+	struct ble_log_packer p;
+
+	frame_count = 0;
+	ble_log_packer_init(&p, emit, NULL);
+	ble_log_packer_set_mtu(&p, 247);
+	ble_log_packer_set_lz(&p, with);
+	for (int i = 0; i < LINES; i++) {
+		ble_log_packer_put(&p, (const uint8_t *)corpus[i], corpus_len[i]);
+	}
+	(void)ble_log_packer_flush(&p);
+
+	return frame_count;
+}
+
+/* Whole input from a fresh window; 0 if it did not all fit. */
+static size_t compress_all(const uint8_t *src, size_t len)
+{
+	size_t used;
+	size_t n;
+
+	ble_log_lz_reset(&lz);
+	n = ble_log_lz_compress(&lz, src, len, out, sizeof(out), &used);
+
+	return (used == len) ? n : 0;
+}
+
+static void *setup(void)
+{
+	build_corpus();
+	return NULL;
+}
+
+ZTEST_SUITE(ble_log_lz, NULL, setup, NULL, NULL, NULL);
+
+ZTEST(ble_log_lz, test_text_round_trip)
+{
+	static uint8_t text[512];
+	size_t len = 0;
+	size_t n;
+
+	for (int i = 0; len + corpus_len[i] <= sizeof(text); i++) {
+		memcpy(&text[len], corpus[i], corpus_len[i]);
+		len += corpus_len[i];
+	}
+
+	n = compress_all(text, len);
+	zassert_true(n > 0);
+	zassert_true(n < len / 2, "text lines compress at least 2:1 (%zu -> %zu)", len, n);
+	zassert_equal(ble_log_lz_decode(out, n, dec, sizeof(dec)), (int)len);
+	zassert_mem_equal(dec, text, len);
+}
+
+ZTEST(ble_log_lz, test_incompressible_bounded)
+{
+	uint8_t rnd[600];
+	uint32_t x = 2463534242U;
+	size_t n;
+
+	for (size_t i = 0; i < sizeof(rnd); i++) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		rnd[i] = (uint8_t)x;
+	}
+
+	n = compress_all(rnd, sizeof(rnd));
+	zassert_true(n > 0);
+	zassert_true(n <= sizeof(rnd) + DIV_ROUND_UP(sizeof(rnd), 128), "one token per 128 literals");
+	zassert_equal(ble_log_lz_decode(out, n, dec, sizeof(dec)), (int)sizeof(rnd));
+	zassert_mem_equal(dec, rnd, sizeof(rnd));
+}
+
+ZTEST(ble_log_lz, test_overlapping_run)
+{
+	uint8_t run[300];
+	size_t n;
+
+	memset(run, '=', sizeof(run));
+	n = compress_all(run, sizeof(run));
+	zassert_true(n > 0);
+	zassert_true(n <= 2 + 2 * DIV_ROUND_UP(sizeof(run), BLE_LOG_LZ_MAX_MATCH));
+	zassert_equal(ble_log_lz_decode(out, n, dec, sizeof(dec)), (int)sizeof(run));
+	zassert_mem_equal(dec, run, sizeof(run));
+}
+
+ZTEST(ble_log_lz, test_output_cap)
+{
+	for (size_t cap = 1; cap < 40; cap++) {
+		size_t used;
+		size_t n;
+
+		ble_log_lz_reset(&lz);
+		n = ble_log_lz_compress(&lz, (const uint8_t *)corpus[0], corpus_len[0], out, cap,
+					&used);
+		zassert_true(n <= cap);
+		zassert_equal(ble_log_lz_decode(out, n, dec, sizeof(dec)), (int)used,
+			      "output covers exactly the consumed prefix (cap %zu)", cap);
+		zassert_mem_equal(dec, corpus[0], used);
+	}
+}
+
+ZTEST(ble_log_lz, test_history_full)
+{
+	uint8_t big[BLE_LOG_LZ_WINDOW];
+	size_t used;
+
+	memset(big, 'x', sizeof(big));
+	ble_log_lz_reset(&lz);
+	(void)ble_log_lz_compress(&lz, big, sizeof(big), out, sizeof(out), &used);
+	zassert_equal(used, BLE_LOG_LZ_WINDOW - ble_log_lz_dict_len);
+	(void)ble_log_lz_compress(&lz, big, 10, out, sizeof(out), &used);
+	zassert_equal(used, 0, "nothing more until reset");
+}
+
+ZTEST(ble_log_lz, test_decode_rejects)
+{
+	const uint8_t truncated_lit[] = { 0x05, 'a', 'b' };
+	const uint8_t truncated_match[] = { 0x80 };
+	const uint8_t too_far[] = { 0x00, 'a', 0x83, 0xFF }; /* 1024 back */
+
+	zassert_equal(ble_log_lz_decode(truncated_lit, sizeof(truncated_lit), dec, sizeof(dec)),
+		      -EBADMSG);
+	zassert_equal(ble_log_lz_decode(truncated_match, sizeof(truncated_match), dec,
+					sizeof(dec)), -EBADMSG);
+	zassert_equal(ble_log_lz_decode(too_far, sizeof(too_far), dec, sizeof(dec)), -EBADMSG);
+	zassert_equal(ble_log_lz_decode(truncated_lit, 2, dec, 0), -EBADMSG);
+	zassert_equal(ble_log_lz_decode((const uint8_t *)"\x01" "ab", 3, dec, 1), -ENOBUFS);
+}
+
+ZTEST(ble_log_lz, test_frames_decode_alone)
+{
+	static uint8_t stream[LINES * 96];
+	size_t stream_len = 0;
+	size_t pos = 0;
+
+	for (int i = 0; i < LINES; i++) {
+		memcpy(&stream[stream_len], corpus[i], corpus_len[i]);
+		stream_len += corpus_len[i];
+	}
+	(void)pack_corpus(&lz);
+
+	/* Decoding each frame on its own (as after losing the one before)
+	 * gives back exactly its slice of the stream. */
+	for (size_t f = 0; f < frame_count; f++) {
+		const uint8_t *payload = &frames[f][BLE_LOG_FRAME_HDR_SIZE];
+		const size_t len = frame_len[f] - BLE_LOG_FRAME_HDR_SIZE;
+		int n;
+
+		zassert_equal(frames[f][0], BLE_LOG_FRAME_FLAGS(BLE_LOG_FRAME_F_LZ));
+		n = ble_log_lz_decode(payload, len, dec, sizeof(dec));
+		zassert_true(n > 0);
+		zassert_mem_equal(dec, &stream[pos], n, "frame %zu", f);
+		pos += n;
+		zassert_equal(frames[f][1], 0, "lines are never split at this MTU");
+	}
+	zassert_equal(pos, stream_len);
+}
+
+ZTEST(ble_log_lz, test_split_message)
+{
+	struct ble_log_packer p;
+	uint8_t big[700];
+	uint32_t x = 1;
+	size_t got = 0;
+
+	for (size_t i = 0; i < sizeof(big); i++) {
+		x = x * 1103515245U + 12345U;
+		big[i] = (uint8_t)(x >> 16);
+	}
+
+	frame_count = 0;
+	ble_log_packer_init(&p, emit, NULL);
+	ble_log_packer_set_mtu(&p, 247);
+	ble_log_packer_set_lz(&p, &lz);
+	ble_log_packer_put(&p, (const uint8_t *)"hi\n", 3);
+	ble_log_packer_put(&p, big, sizeof(big));
+	(void)ble_log_packer_flush(&p);
+
+	zassert_true(frame_count >= 4, "700 random bytes take three frames");
+	zassert_equal(frames[1][1], 0, "moved whole to a fresh frame first");
+	zassert_equal(frames[2][1], BLE_LOG_FRAME_NO_START, "continuation");
+	for (size_t f = 0; f < frame_count; f++) {
+		const int n = ble_log_lz_decode(&frames[f][BLE_LOG_FRAME_HDR_SIZE],
+						frame_len[f] - BLE_LOG_FRAME_HDR_SIZE,
+						&dec[got], sizeof(dec) - got);
+
+		zassert_true(n > 0);
+		got += n;
+	}
+	zassert_equal(got, 3 + sizeof(big));
+	zassert_mem_equal(&dec[3], big, sizeof(big));
+}
+
+ZTEST(ble_log_lz, test_numbers)
+{
+	size_t raw = 0;
+	size_t plain;
+	size_t packed;
+	uint32_t start;
+	uint32_t ns_plain;
+	uint32_t ns_lz;
+
+	for (int i = 0; i < LINES; i++) {
+		raw += corpus_len[i];
+	}
+
+	start = k_cycle_get_32();
+	plain = pack_corpus(NULL);
+	ns_plain = (uint32_t)k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+
+	start = k_cycle_get_32();
+	packed = pack_corpus(&lz);
+	ns_lz = (uint32_t)k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+
+	TC_PRINT("RATIO,text,%zu,%zu,%zu\n", raw, plain, packed);
+	TC_PRINT("BENCH,ble_log_packer_put,plain,lines=%d,%u\n", LINES, ns_plain / LINES);
+	TC_PRINT("BENCH,ble_log_packer_put,lz,lines=%d,%u\n", LINES, ns_lz / LINES);
+	zassert_true(packed * 2 <= plain + 1, "half the notifications or fewer");
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <ble_log/ble_log_ring.h>
+
+#define ERR (1)
+#define WRN (2)
+#define INF (3)
+#define DBG (4)
+
+#define RING_SIZE (256)
+#define MSG_LEN   (12) /* 16 bytes with the record header */
+
+static uint8_t buf[RING_SIZE];
+static struct ble_log_ring r;
+static uint8_t msg[MSG_LEN];
+static uint8_t got[RING_SIZE];
+
+static void reset(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	/* Congested at 192 bytes (12 messages), clear at 64. */
+	ble_log_ring_init(&r, buf, sizeof(buf), 75, 25);
+	memset(msg, 'm', sizeof(msg));
+}
+
+static int put(uint8_t level)
+{
+	return ble_log_ring_put(&r, level, msg, sizeof(msg));
+}
+
+static int get(uint8_t *level)
+{
+	return ble_log_ring_get(&r, level, got, sizeof(got));
+}
+
+ZTEST_SUITE(ble_log_ring, NULL, NULL, reset, NULL, NULL);
+
+ZTEST(ble_log_ring, test_fifo_across_wrap)
+{
+	uint8_t level;
+
+	zassert_equal(get(&level), -EAGAIN);
+
+	for (uint32_t i = 0; i < 200; i++) {
+		uint8_t m[40];
+		const size_t len = 1 + (i * 7) % sizeof(m);
+
+		memset(m, (uint8_t)i, len);
+		zassert_ok(ble_log_ring_put(&r, INF, m, len));
+		if (i % 3 == 0) {
+			continue; /* let it fill a little */
+		}
+		while (ble_log_ring_used(&r) > 0) {
+			const int n = get(&level);
+
+			zassert_true(n > 0);
+			zassert_equal(level, INF);
+			zassert_equal(got[n - 1], got[0], "not torn");
+		}
+	}
+	zassert_equal(r.dropped[INF - 1], 0);
+}
+
+ZTEST(ble_log_ring, test_sheds_dbg_then_inf_then_wrn)
+{
+	for (int i = 0; i < 12; i++) {
+		zassert_ok(put(INF));
+	}
+	zassert_false(ble_log_ring_congested(&r));
+
+	/* 192 used: congested, first third sheds DBG only. */
+	zassert_equal(put(DBG), -ENOSPC);
+	zassert_true(ble_log_ring_congested(&r));
+	zassert_ok(put(INF));               /* 208 */
+	zassert_ok(put(INF));               /* 224: into the second third */
+	zassert_equal(put(INF), -ENOSPC);
+	zassert_ok(put(WRN));               /* 240: last third, ERR only */
+	zassert_equal(put(WRN), -ENOSPC);
+	zassert_ok(put(ERR));               /* 256: full */
+	zassert_equal(put(ERR), -ENOSPC, "ERR lost only without room");
+
+	zassert_equal(r.dropped[ERR - 1], 1);
+	zassert_equal(r.dropped[WRN - 1], 1);
+	zassert_equal(r.dropped[INF - 1], 1);
+	zassert_equal(r.dropped[DBG - 1], 1);
+	zassert_equal(r.peak, RING_SIZE);
+}
+
+ZTEST(ble_log_ring, test_drop_report_when_clear)
+{
+	uint8_t level;
+	int n;
+
+	for (int i = 0; i < 12; i++) {
+		zassert_ok(put(INF));
+	}
+	zassert_equal(put(DBG), -ENOSPC);
+	zassert_equal(put(DBG), -ENOSPC);
+
+	/* Drain to 128 bytes: below high, still above low. */
+	for (int i = 0; i < 4; i++) {
+		zassert_equal(get(&level), MSG_LEN);
+	}
+	zassert_equal(put(DBG), -ENOSPC, "hysteresis: still shedding");
+	zassert_true(ble_log_ring_congested(&r));
+
+	/* Drain to 64: clear. The report goes in ahead of the next message. */
+	for (int i = 0; i < 4; i++) {
+		zassert_equal(get(&level), MSG_LEN);
+	}
+	zassert_ok(put(DBG));
+	zassert_false(ble_log_ring_congested(&r));
+
+	for (int i = 0; i < 4; i++) {
+		zassert_equal(get(&level), MSG_LEN);
+		zassert_equal(level, INF);
+	}
+	n = get(&level);
+	zassert_equal(level, BLE_LOG_RING_DROPS);
+	zassert_equal(n, BLE_LOG_RING_DROPS_SIZE);
+	zassert_equal(sys_get_le32(&got[0]), 0, "ERR");
+	zassert_equal(sys_get_le32(&got[12]), 3, "DBG");
+	zassert_equal(get(&level), MSG_LEN);
+	zassert_equal(level, DBG);
+
+	/* Counts restart after a report; totals do not. */
+	zassert_ok(put(DBG));
+	zassert_equal(get(&level), MSG_LEN);
+	zassert_equal(level, DBG, "no second report");
+	zassert_equal(r.dropped[DBG - 1], 3);
+}
+
+ZTEST(ble_log_ring, test_sizes)
+{
+	uint8_t big[RING_SIZE] = { 0 };
+	uint8_t level;
+
+	zassert_ok(ble_log_ring_put(&r, WRN, "long message", 12));
+	zassert_ok(ble_log_ring_put(&r, WRN, "next", 4));
+	zassert_equal(ble_log_ring_get(&r, &level, got, 4), -ENOBUFS);
+	zassert_equal(ble_log_ring_get(&r, &level, got, 4), 4, "only that one discarded");
+	zassert_mem_equal(got, "next", 4);
+
+	zassert_equal(ble_log_ring_put(&r, ERR, big, sizeof(big)), -EMSGSIZE);
+	zassert_equal(r.dropped[ERR - 1], 1);
+}
+
+ZTEST(ble_log_ring, test_burst)
+{
+	/* A burst logging one line per tick against a link that drains one
+	 * every other tick, then a quiet spell and one more line: the ring
+	 * sheds DBG first, keeps every ERR and reports once it is clear. */
+	static const uint8_t mix[] = { DBG, DBG, INF, DBG, WRN, DBG, INF, ERR };
+	uint32_t sent[BLE_LOG_RING_LEVELS + 1] = { 0 };
+	uint8_t level;
+
+	for (int t = 0; t < 400; t++) {
+		(void)put(mix[t % ARRAY_SIZE(mix)]);
+		if (t % 2 == 0 && get(&level) > 0) {
+			sent[level]++;
+		}
+	}
+	while (get(&level) > 0) {
+		sent[level]++;
+	}
+	zassert_ok(put(INF));
+	while (get(&level) > 0) {
+		sent[level]++;
+	}
+
+	TC_PRINT("SHED,err=%u,wrn=%u,inf=%u,dbg=%u,reports=%u\n", r.dropped[0], r.dropped[1],
+		 r.dropped[2], r.dropped[3], sent[BLE_LOG_RING_DROPS]);
+	zassert_equal(r.dropped[ERR - 1], 0);
+	zassert_true(r.dropped[DBG - 1] > r.dropped[WRN - 1]);
+	zassert_equal(sent[ERR], 400 / ARRAY_SIZE(mix));
+	zassert_equal(sent[BLE_LOG_RING_DROPS], 1);
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * ble_log_store on the flash simulator (four 1 KB sectors, as tests/tlog):
+ * replayed frames are decoded back into records the way the host does, so
+ * the tests check which seqs went out, in what order and with which bytes.
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <ble_log/ble_log_frame.h>
+#include <ble_log/ble_log_store.h>
+
+#define LOG_AREA FIXED_PARTITION_ID(log_partition)
+#define MAX_RECORDS (128)
+
+static struct ble_log_packer p;
+/* Seq the next put() gets; marks take one too. */
+static uint32_t next_seq;
+
+/* Decoded records, in arrival order. */
+static uint32_t got_seq[MAX_RECORDS];
+static uint16_t got_len[MAX_RECORDS];
+static size_t got_count;
+static size_t bad_records;
+static size_t live_frames;
+
+/* Host-side reassembly: payloads concatenated while frame seqs are
+ * contiguous, restarted at @c first after a gap. */
+static uint8_t stream[2 * BLE_LOG_FRAME_MAX];
+static size_t stream_len;
+static bool in_sync;
+static uint16_t expect_frame;
+static int frames;
+static int refuse_frame;
+
+/* Payload of record seq: len bytes counting up from seq. */
+static void fill(uint8_t *buf, uint32_t seq, uint16_t len)
+{
+	for (uint16_t i = 0; i < len; i++) {
+		buf[i] = (uint8_t)(seq + i);
+	}
+}
+
+static void take_record(uint32_t seq, const uint8_t *msg, uint16_t len)
+{
+	uint8_t want[CONFIG_NRFMODULE_BLE_LOG_STORE_MSG_MAX];
+
+	fill(want, seq, len);
+	if (memcmp(msg, want, len) != 0) {
+		bad_records++;
+	}
+	if (got_count < MAX_RECORDS) {
+		got_seq[got_count] = seq;
+		got_len[got_count] = len;
+	}
+	got_count++;
+}
+
+static int emit(const uint8_t *frame, size_t len, void *ctx)
+{
+	const uint16_t seq = frame[2] | (frame[3] << 8);
+	size_t pos = BLE_LOG_FRAME_HDR_SIZE;
+
+	ARG_UNUSED(ctx);
+
+	if (frames++ == refuse_frame) {
+		return -EAGAIN;
+	}
+	if (!(frame[0] & BLE_LOG_FRAME_F_STORED)) {
+		live_frames++;
+	}
+
+	if (!in_sync || seq != expect_frame) {
+		stream_len = 0;
+		in_sync = (frame[1] != BLE_LOG_FRAME_NO_START);
+		pos += frame[1];
+	}
+	expect_frame = seq + 1;
+	if (!in_sync) {
+		return 0;
+	}
+
+	memcpy(&stream[stream_len], &frame[pos], len - pos);
+	stream_len += len - pos;
+
+	while (stream_len >= BLE_LOG_STORED_HDR_SIZE) {
+		const uint32_t rec_seq = sys_get_le32(&stream[0]);
+		const uint16_t rec_len = sys_get_le16(&stream[4]);
+		const size_t size = BLE_LOG_STORED_HDR_SIZE + rec_len;
+
+		if (stream_len < size) {
+			break;
+		}
+		take_record(rec_seq, &stream[BLE_LOG_STORED_HDR_SIZE], rec_len);
+		stream_len -= size;
+		memmove(stream, &stream[size], stream_len);
+	}
+
+	return 0;
+}
+
+/* A fresh subscribe: new packer, host decoder starts over. */
+static void subscribe(uint16_t att_mtu)
+{
+	ble_log_packer_init(&p, emit, NULL);
+	ble_log_packer_set_mtu(&p, att_mtu);
+	got_count = 0;
+	bad_records = 0;
+	live_frames = 0;
+	stream_len = 0;
+	in_sync = false;
+	frames = 0;
+	refuse_frame = -1;
+}
+
+static void put(uint16_t len)
+{
+	uint8_t msg[CONFIG_NRFMODULE_BLE_LOG_STORE_MSG_MAX];
+
+	fill(msg, next_seq, len);
+	zassert_ok(ble_log_store_put(msg, len));
+	next_seq++;
+}
+
+/* Replay in small steps until caught up; returns the last result. */
+static int replay_all(void)
+{
+	int ret;
+
+	do {
+		ret = ble_log_store_replay(&p, 8);
+	} while (ret > 0);
+
+	return ret;
+}
+
+/* Let the flush timer write what is staged, then remount. */
+static void reboot(void)
+{
+	k_sleep(K_MSEC(CONFIG_NRFMODULE_BLE_LOG_STORE_FLUSH_S * MSEC_PER_SEC + 100));
+	zassert_ok(ble_log_store_init(LOG_AREA));
+	subscribe(BLE_LOG_FRAME_MAX + 3);
+}
+
+/* got[from..] is exactly seqs first..last in order, the last one a mark. */
+static void expect_run(size_t from, uint32_t first, uint32_t last)
+{
+	zassert_equal(got_count - from, last - first + 1, "%zu records", got_count - from);
+	for (uint32_t seq = first; seq <= last; seq++) {
+		zassert_equal(got_seq[from + seq - first], seq);
+	}
+	zassert_equal(got_len[got_count - 1], 0, "ends with the mark");
+	zassert_equal(bad_records, 0);
+	zassert_equal(live_frames, 0, "replay frames are all F_STORED");
+}
+
+static void before(void *fixture)
+{
+	const struct flash_area *fa;
+
+	ARG_UNUSED(fixture);
+	zassert_ok(flash_area_open(LOG_AREA, &fa));
+	zassert_ok(flash_area_erase(fa, 0, fa->fa_size));
+	zassert_ok(ble_log_store_init(LOG_AREA));
+	next_seq = 0;
+	subscribe(BLE_LOG_FRAME_MAX + 3);
+}
+
+ZTEST_SUITE(ble_log_store, NULL, NULL, before, NULL, NULL);
+
+ZTEST(ble_log_store, test_put_rejects)
+{
+	uint8_t big[CONFIG_NRFMODULE_BLE_LOG_STORE_MSG_MAX + 1] = { 0 };
+
+	zassert_equal(ble_log_store_put(big, 0), -EINVAL, "empty is a mark");
+	zassert_equal(ble_log_store_put(big, sizeof(big)), -EMSGSIZE);
+
+	zassert_equal(replay_all(), 0);
+	zassert_equal(got_count, 0, "an empty store sends nothing, not even a mark");
+}
+
+ZTEST(ble_log_store, test_replay_resumes_after_reboot)
+{
+	for (int i = 0; i < 10; i++) {
+		put(20);
+	}
+	zassert_equal(replay_all(), 0);
+	expect_run(0, 0, 10);
+	next_seq++;
+
+	reboot();
+	zassert_equal(replay_all(), 0);
+	zassert_equal(got_count, 0, "everything up to the mark went out before");
+
+	for (int i = 0; i < 3; i++) {
+		put(20);
+	}
+	reboot();
+	zassert_equal(replay_all(), 0);
+	expect_run(0, 11, 14);
+}
+
+ZTEST(ble_log_store, test_mark_not_duplicated)
+{
+	for (int i = 0; i < 5; i++) {
+		put(20);
+	}
+	zassert_equal(replay_all(), 0);
+	expect_run(0, 0, 5);
+	next_seq++;
+
+	/* Caught up already: no second mark behind the first. */
+	zassert_equal(replay_all(), 0);
+	reboot();
+	zassert_equal(replay_all(), 0);
+	zassert_equal(got_count, 0);
+
+	put(20);
+	zassert_equal(replay_all(), 0);
+	expect_run(0, 6, 7);
+}
+
+ZTEST(ble_log_store, test_refused_emit_rewinds)
+{
+	size_t resumed;
+
+	/* 26-byte records in 37-byte frames: one record per frame. */
+	for (int i = 0; i < 12; i++) {
+		put(20);
+	}
+	subscribe(40);
+	refuse_frame = 4;
+	zassert_equal(ble_log_store_replay(&p, 100), -EAGAIN);
+	zassert_equal(got_count, 4, "frames before the refused one arrived");
+	zassert_equal(got_seq[3], 3);
+
+	resumed = got_count;
+	refuse_frame = -1;
+	zassert_equal(replay_all(), 0);
+	zassert_equal(got_seq[resumed], 4, "resumes at the refused frame's record");
+	expect_run(resumed, 4, 12);
+}
+
+ZTEST(ble_log_store, test_wrap_skips_dropped_records)
+{
+	uint32_t first;
+
+	for (int i = 0; i < 10; i++) {
+		put(20);
+	}
+	zassert_equal(replay_all(), 0);
+	next_seq++;
+
+	/* 112 bytes on flash each: 60 go round the four sectors, taking the
+	 * mark and the first new records with them. */
+	for (int i = 0; i < 60; i++) {
+		put(100);
+	}
+	subscribe(BLE_LOG_FRAME_MAX + 3);
+	zassert_equal(replay_all(), 0);
+	zassert_true(got_count > 0);
+	first = got_seq[0];
+	zassert_true(first > 11, "oldest records dropped (first %u)", first);
+	expect_run(0, first, 71);
+	next_seq++;
+
+	reboot();
+	zassert_equal(replay_all(), 0);
+	zassert_equal(got_count, 0, "the mark written after the wrap holds");
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * BMP390 compensation: float path accuracy against the integer reference,
+ * plus per-sample cost of each path as BENCH rows (see tests/led_bench):
+ *
+ *   BENCH,<function>,<variant>,<param>,<ns_per_call>
+ */
+
+#include <zephyr/ztest.h>
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <bmp390_comp.h>
+
+#define ITERATIONS (500)
+
+/* Representative calibration: -2..51 C and 30..125 kPa over the sweep below. */
+static const struct bmp388_cal_data cal = {
+	.t1 = 27811, .t2 = 19043, .t3 = -7,
+	.p1 = 2000, .p2 = 3000, .p3 = 35, .p4 = 0, .p5 = 25000, .p6 = 28000,
+	.p7 = 3, .p8 = -5, .p9 = 16000, .p10 = 24, .p11 = -60,
+};
+
+static volatile uint32_t sink; /* keeps results live */
+
+ZTEST_SUITE(bmp390_comp, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(bmp390_comp, test_float_matches_integer)
+{
+	struct bmp390_cal_float calf;
+	float max_dt = 0.0f;
+	float max_dp = 0.0f;
+	int checked = 0;
+
+	bmp390_cal_to_float(&cal, &calf);
+
+	for (uint32_t rt = 7000000; rt <= 10000000; rt += 100000) {
+		const int64_t t_lin = bmp388_compensate_temp(&cal, rt);
+		const float t_int = (float)t_lin / 65536.0f;
+		const float t_flt = bmp390_compensate_temp_f(&calf, rt);
+
+		for (uint32_t rp = 5000000; rp <= 9000000; rp += 100000) {
+			const float p_int = (float)bmp388_compensate_press(&cal, rp, t_lin) / 100.0f;
+			const float p_flt = bmp390_compensate_press_f(&calf, rp, t_flt);
+
+			/* Only the sensor's operating range is meaningful. */
+			if (p_int < 30000.0f || p_int > 125000.0f) {
+				continue;
+			}
+
+			max_dt = MAX(max_dt, fabsf(t_int - t_flt));
+			max_dp = MAX(max_dp, fabsf(p_int - p_flt));
+			checked++;
+		}
+	}
+
+	TC_PRINT("max |dT| = %d uC, max |dP| = %d mPa over %d points\n",
+		 (int)(max_dt * 1e6f), (int)(max_dp * 1e3f), checked);
+	zassert_true(checked > 100, "sweep covers the operating range");
+	zassert_true(max_dt < 0.001f, "temperature within 1 mC of integer path");
+	zassert_true(max_dp < 0.5f, "pressure within 0.5 Pa of integer path");
+}
+
+ZTEST(bmp390_comp, test_bench)
+{
+	struct bmp390_cal_float calf;
+	uint32_t start;
+	uint32_t ns;
+
+	TC_PRINT("BENCH,function,variant,param,ns_per_call\n");
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		const uint32_t rt = 8000000 + i * 97U;
+		const int64_t t_lin = bmp388_compensate_temp(&cal, rt);
+
+		sink += (uint32_t)bmp388_compensate_press(&cal, 7000000 + i * 131U, t_lin);
+	}
+	ns = (uint32_t)(k_cyc_to_ns_floor64(k_cycle_get_32() - start) / ITERATIONS);
+	TC_PRINT("BENCH,bmp390_compensate,int,-,%u\n", ns);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		bmp390_cal_to_float(&cal, &calf);
+	}
+	ns = (uint32_t)(k_cyc_to_ns_floor64(k_cycle_get_32() - start) / ITERATIONS);
+	TC_PRINT("BENCH,bmp390_cal_to_float,float,-,%u\n", ns);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		const uint32_t rt = 8000000 + i * 97U;
+		const float t = bmp390_compensate_temp_f(&calf, rt);
+
+		sink += (uint32_t)bmp390_compensate_press_f(&calf, 7000000 + i * 131U, t);
+	}
+	ns = (uint32_t)(k_cyc_to_ns_floor64(k_cycle_get_32() - start) / ITERATIONS);
+	TC_PRINT("BENCH,bmp390_compensate,float,-,%u\n", ns);
+}
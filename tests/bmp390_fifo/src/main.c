@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * BMP390 FIFO parser on canned FIFO_DATA bursts: frame kinds, the truncated
+ * drain bmp390_fifo_read() does when the caller takes fewer frames than are
+ * queued, and sensortime back-dating across the 24-bit wrap.
+ */
+
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#include "bmp390_fifo_parse.h"
+
+#define LE24(v) ((v) & 0xFF), (((v) >> 8) & 0xFF), (((v) >> 16) & 0xFF)
+/* Pressure + temperature frame: temperature comes first on the wire. */
+#define PT(t, p) BMP388_FIFO_FRAME_PRESS_TEMP, LE24(t), LE24(p)
+#define TIME(st) BMP388_FIFO_FRAME_TIME, LE24(st)
+
+#define MAX_FRAMES (8)
+
+static uint32_t got_press[MAX_FRAMES];
+static uint32_t got_temp[MAX_FRAMES];
+static size_t calls;
+
+static void on_frame(void *ctx, size_t idx, uint32_t raw_press, uint32_t raw_temp)
+{
+	ARG_UNUSED(ctx);
+
+	if (idx < MAX_FRAMES) {
+		got_press[idx] = raw_press;
+		got_temp[idx] = raw_temp;
+	}
+	calls++;
+}
+
+static size_t parse(const uint8_t *buf, size_t len, size_t max_frames, uint32_t *sensor_time)
+{
+	return bmp390_fifo_parse(buf, len, max_frames, on_frame, NULL, sensor_time);
+}
+
+static void reset(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	memset(got_press, 0, sizeof(got_press));
+	memset(got_temp, 0, sizeof(got_temp));
+	calls = 0;
+}
+
+ZTEST_SUITE(bmp390_fifo, NULL, NULL, reset, NULL, NULL);
+
+ZTEST(bmp390_fifo, test_frames_then_sensortime)
+{
+	const uint8_t buf[] = {
+		PT(0x7A1200, 0x5B8D80),
+		PT(0x7A1201, 0x5B8D81),
+		PT(0x7A1202, 0x5B8D82),
+		TIME(0x001000),
+	};
+	uint32_t st;
+
+	zassert_equal(parse(buf, sizeof(buf), MAX_FRAMES, &st), 3);
+	zassert_equal(calls, 3);
+	zassert_equal(st, 0x001000);
+	for (uint32_t i = 0; i < 3; i++) {
+		zassert_equal(got_temp[i], 0x7A1200 + i, "frame %u", i);
+		zassert_equal(got_press[i], 0x5B8D80 + i, "frame %u", i);
+	}
+}
+
+ZTEST(bmp390_fifo, test_skips_config_and_single_channel_frames)
+{
+	const uint8_t buf[] = {
+		PT(0x000001, 0x000011),
+		BMP388_FIFO_FRAME_CONFIG_CHG, 0x00,
+		PT(0x000002, 0x000012),
+		BMP388_FIFO_FRAME_CONFIG_ERR, 0x00,
+		BMP388_FIFO_FRAME_TEMP, LE24(0x0000FF),
+		BMP388_FIFO_FRAME_PRESS, LE24(0x0000FF),
+		PT(0x000003, 0x000013),
+		TIME(0x000200),
+	};
+	uint32_t st;
+
+	zassert_equal(parse(buf, sizeof(buf), MAX_FRAMES, &st), 3);
+	zassert_equal(got_temp[1], 0x000002);
+	zassert_equal(got_press[2], 0x000013, "stays in step after skipped frames");
+	zassert_equal(st, 0x000200);
+}
+
+ZTEST(bmp390_fifo, test_empty_frame_ends_walk)
+{
+	const uint8_t buf[] = {
+		PT(0x000001, 0x000011),
+		BMP388_FIFO_FRAME_EMPTY, 0x00,
+		PT(0x000002, 0x000012),
+		TIME(0x000200),
+	};
+	uint32_t st;
+
+	zassert_equal(parse(buf, sizeof(buf), MAX_FRAMES, &st), 1);
+	zassert_equal(st, BMP390_FIFO_TIME_NONE);
+}
+
+ZTEST(bmp390_fifo, test_truncated_drain)
+{
+	const uint8_t buf[] = {
+		PT(0x000001, 0x000011),
+		PT(0x000002, 0x000012),
+		PT(0x000003, 0x000013),
+		PT(0x000004, 0x000014),
+		TIME(0x000200),
+	};
+	uint32_t st;
+
+	/* bmp390_fifo_read() with max_frames = 2 reads only 2 frames' bytes:
+	 * no sensortime frame comes with them.
+	 */
+	zassert_equal(parse(buf, 2 * BMP388_FIFO_FRAME_SIZE, 2, &st), 2);
+	zassert_equal(st, BMP390_FIFO_TIME_NONE);
+	zassert_equal(got_press[1], 0x000012);
+
+	/* A full burst with a smaller cap stops at the cap. */
+	reset(NULL);
+	zassert_equal(parse(buf, sizeof(buf), 3, &st), 3);
+	zassert_equal(calls, 3);
+
+	/* A frame cut short by the burst length is not reported. */
+	reset(NULL);
+	zassert_equal(parse(buf, 2 * BMP388_FIFO_FRAME_SIZE + 3, MAX_FRAMES, &st), 2);
+
+	/* Nor is a cut sensortime frame. */
+	reset(NULL);
+	zassert_equal(parse(buf, sizeof(buf) - 1, MAX_FRAMES, &st), 4);
+	zassert_equal(st, BMP390_FIFO_TIME_NONE);
+}
+
+ZTEST(bmp390_fifo, test_frame_time_back_dates)
+{
+	zassert_equal(bmp390_fifo_frame_time(1000, 3, 0, 128), 744);
+	zassert_equal(bmp390_fifo_frame_time(1000, 3, 1, 128), 872);
+	zassert_equal(bmp390_fifo_frame_time(1000, 3, 2, 128), 1000, "newest carries it");
+	zassert_equal(bmp390_fifo_frame_time(BMP390_FIFO_TIME_NONE, 3, 0, 128),
+		      BMP390_FIFO_TIME_NONE);
+}
+
+ZTEST(bmp390_fifo, test_frame_time_wraps_at_24_bits)
+{
+	const uint8_t buf[] = {
+		PT(0x000001, 0x000011),
+		PT(0x000002, 0x000012),
+		PT(0x000003, 0x000013),
+		PT(0x000004, 0x000014),
+		TIME(0x000040),
+	};
+	/* ODR setting 1: 10 ms, 256 ticks. */
+	const uint32_t period = BMP388_SENSORTIME_TICKS_PER_ODR0 << 1;
+	const uint32_t want[] = { 0xFFFD40, 0xFFFE40, 0xFFFF40, 0x000040 };
+	uint32_t st;
+	size_t n;
+
+	n = parse(buf, sizeof(buf), MAX_FRAMES, &st);
+	zassert_equal(n, 4);
+	for (size_t i = 0; i < n; i++) {
+		zassert_equal(bmp390_fifo_frame_time(st, n, i, period), want[i], "frame %zu", i);
+	}
+}
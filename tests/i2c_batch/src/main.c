@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * i2c_batch against two emulated register-file targets: transfers and
+ * completion order, per-read errors, and re-queueing a read while its run
+ * is still in flight.
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <bus/i2c_batch.h>
+
+#include "regs_emul.h"
+
+#define BUS_NODE DT_NODELABEL(test_i2c)
+
+static const struct emul *emul_a = EMUL_DT_GET(DT_NODELABEL(regs_a));
+static const struct emul *emul_b = EMUL_DT_GET(DT_NODELABEL(regs_b));
+static struct regs_emul_data *regs_a;
+static struct regs_emul_data *regs_b;
+
+static struct i2c_batch batch;
+static struct i2c_batch_read rd_a;
+static struct i2c_batch_read rd_b;
+static uint8_t buf_a[3];
+static uint8_t buf_b[6];
+
+/* Completion log: which reads finished, in order. */
+static struct i2c_batch_read *done_order[4];
+static int done_count;
+static bool requeue;
+static int requeue_ret;
+static int in_flight_ret;
+
+static void log_done(struct i2c_batch_read *rd)
+{
+	if (done_count < ARRAY_SIZE(done_order)) {
+		done_order[done_count] = rd;
+	}
+	done_count++;
+
+	if (requeue) {
+		requeue = false;
+		requeue_ret = i2c_batch_add(&batch, rd);
+	}
+}
+
+/* During B's transfer A has been read but not completed yet. */
+static void add_a_in_flight(const struct emul *target)
+{
+	ARG_UNUSED(target);
+	in_flight_ret = i2c_batch_add(&batch, &rd_a);
+}
+
+static void init_read(struct i2c_batch_read *rd, uint16_t addr, uint8_t reg, uint8_t *buf,
+		      uint8_t len)
+{
+	memset(rd, 0, sizeof(*rd));
+	rd->addr = addr;
+	rd->reg = reg;
+	rd->buf = buf;
+	rd->len = len;
+	rd->done = log_done;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	regs_a = emul_a->data;
+	regs_b = emul_b->data;
+	memset(regs_a, 0, sizeof(*regs_a));
+	memset(regs_b, 0, sizeof(*regs_b));
+	for (int i = 0; i < 256; i++) {
+		regs_a->regs[i] = (uint8_t)i;
+		regs_b->regs[i] = (uint8_t)(0xFF - i);
+	}
+
+	i2c_batch_init(&batch, DEVICE_DT_GET(BUS_NODE));
+	init_read(&rd_a, DT_REG_ADDR(DT_NODELABEL(regs_a)), 0x04, buf_a, sizeof(buf_a));
+	init_read(&rd_b, DT_REG_ADDR(DT_NODELABEL(regs_b)), 0x20, buf_b, sizeof(buf_b));
+	memset(done_order, 0, sizeof(done_order));
+	done_count = 0;
+	requeue = false;
+	requeue_ret = 1;
+	in_flight_ret = 1;
+}
+
+ZTEST_SUITE(i2c_batch, NULL, NULL, before, NULL, NULL);
+
+ZTEST(i2c_batch, test_reads_in_queue_order)
+{
+	const uint8_t want_a[] = { 0x04, 0x05, 0x06 };
+	const uint8_t want_b[] = { 0xDF, 0xDE, 0xDD, 0xDC, 0xDB, 0xDA };
+
+	zassert_ok(i2c_batch_add(&batch, &rd_a));
+	zassert_ok(i2c_batch_add(&batch, &rd_b));
+	zassert_ok(i2c_batch_run(&batch));
+
+	zassert_mem_equal(buf_a, want_a, sizeof(want_a));
+	zassert_mem_equal(buf_b, want_b, sizeof(want_b));
+	zassert_equal(regs_a->transfers, 1);
+	zassert_equal(regs_b->transfers, 1);
+	zassert_equal(done_count, 2);
+	zassert_equal_ptr(done_order[0], &rd_a);
+	zassert_equal_ptr(done_order[1], &rd_b);
+	zassert_ok(rd_a.err);
+	zassert_ok(rd_b.err);
+
+	zassert_ok(i2c_batch_run(&batch), "empty run");
+	zassert_equal(regs_a->transfers, 1);
+}
+
+ZTEST(i2c_batch, test_add_rejects)
+{
+	struct i2c_batch_read empty = rd_a;
+
+	empty.len = 0;
+	zassert_equal(i2c_batch_add(&batch, &empty), -EINVAL);
+
+	zassert_ok(i2c_batch_add(&batch, &rd_a));
+	zassert_equal(i2c_batch_add(&batch, &rd_a), -EALREADY);
+}
+
+ZTEST(i2c_batch, test_error_is_per_read)
+{
+	regs_a->fail = -EIO;
+
+	zassert_ok(i2c_batch_add(&batch, &rd_a));
+	zassert_ok(i2c_batch_add(&batch, &rd_b));
+	zassert_equal(i2c_batch_run(&batch), -EIO);
+
+	zassert_equal(rd_a.err, -EIO);
+	zassert_ok(rd_b.err, "later reads still run");
+	zassert_equal(done_count, 2, "every completion runs");
+}
+
+ZTEST(i2c_batch, test_add_while_in_flight)
+{
+	regs_b->hook = add_a_in_flight;
+
+	zassert_ok(i2c_batch_add(&batch, &rd_a));
+	zassert_ok(i2c_batch_add(&batch, &rd_b));
+	zassert_ok(i2c_batch_run(&batch));
+
+	zassert_equal(in_flight_ret, -EBUSY, "A is still linked in the run");
+	zassert_equal(done_count, 2, "the run's walk stayed intact");
+	zassert_equal_ptr(done_order[1], &rd_b);
+
+	regs_b->hook = NULL;
+	zassert_ok(i2c_batch_run(&batch));
+	zassert_equal(regs_a->transfers, 1, "the refused add queued nothing");
+}
+
+ZTEST(i2c_batch, test_requeue_from_completion)
+{
+	requeue = true;
+
+	zassert_ok(i2c_batch_add(&batch, &rd_a));
+	zassert_ok(i2c_batch_add(&batch, &rd_b));
+	zassert_ok(i2c_batch_run(&batch));
+	zassert_ok(requeue_ret, "a completion may queue its read for the next run");
+	zassert_equal(done_count, 2);
+
+	zassert_ok(i2c_batch_run(&batch));
+	zassert_equal(regs_a->transfers, 2);
+	zassert_equal(regs_b->transfers, 1);
+	zassert_equal(done_count, 3);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Register-file I2C target for zephyr,i2c-emul-controller.
+ */
+
+#define DT_DRV_COMPAT nrfmodule_test_i2c_regs
+
+#include "regs_emul.h"
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+
+static int regs_transfer(const struct emul *target, struct i2c_msg *msgs, int num_msgs,
+			 int addr)
+{
+	struct regs_emul_data *data = target->data;
+
+	ARG_UNUSED(addr);
+
+	if (data->hook != NULL) {
+		data->hook(target);
+	}
+	if (data->fail != 0) {
+		return data->fail;
+	}
+
+	for (int i = 0; i < num_msgs; i++) {
+		if (msgs[i].flags & I2C_MSG_READ) {
+			for (uint32_t j = 0; j < msgs[i].len; j++) {
+				msgs[i].buf[j] = data->regs[data->ptr++];
+			}
+		} else if (msgs[i].len > 0) {
+			data->ptr = msgs[i].buf[0];
+		}
+	}
+	data->transfers++;
+
+	return 0;
+}
+
+static const struct i2c_emul_api regs_api = {
+	.transfer = regs_transfer,
+};
+
+static int regs_emul_init(const struct emul *target, const struct device *parent)
+{
+	ARG_UNUSED(target);
+	ARG_UNUSED(parent);
+
+	return 0;
+}
+
+#define REGS_EMUL(n)								\
+	static struct regs_emul_data regs_emul_data_##n;			\
+	EMUL_DT_INST_DEFINE(n, regs_emul_init, &regs_emul_data_##n, NULL,	\
+			    &regs_api, NULL);					\
+	DEVICE_DT_INST_DEFINE(n, NULL, NULL, NULL, NULL, POST_KERNEL,		\
+			      CONFIG_APPLICATION_INIT_PRIORITY, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(REGS_EMUL)
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef REGS_EMUL_H_
+#define REGS_EMUL_H_
+
+#include <stdint.h>
+#include <zephyr/drivers/emul.h>
+
+/** Called at the start of every transfer to the target. */
+typedef void (*regs_emul_hook_t)(const struct emul *target);
+
+struct regs_emul_data {
+	uint8_t regs[256];
+	uint8_t ptr;          /**< Set by a one-byte write, auto-increments. */
+	int fail;             /**< Non-zero: transfers return this. */
+	uint32_t transfers;   /**< Transfers that completed. */
+	regs_emul_hook_t hook;
+};
+
+#endif /* REGS_EMUL_H_ */
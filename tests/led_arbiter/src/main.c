@@ -100,3 +100,99 @@ ZTEST(led_arbiter, test_clear)
 	led_arbiter_clear(&a, L_TRACK);
 	zassert_true(eq(led_arbiter_render(&a, 0), C(0, 0, 0)), "cleared");
 }
+
+/* Solid colours for the compositing tests. */
+static const struct led_effect_step s_grey[]  = { { C(100, 100, 100), 1, 1000 } };
+static const struct led_effect_step s_warm[]  = { { C(200, 100, 50),  1, 1000 } };
+static const struct led_effect_step s_blue[]  = { { C(0, 0, 255),     1, 1000 } };
+static const struct led_effect_step s_add[]   = { { C(200, 50, 0),    1, 1000 } };
+static const struct led_effect_step s_tint[]  = { { C(128, 255, 0),   1, 1000 } };
+static const struct led_effect_step s_half[]  = { { C(128, 128, 128), 1, 1000 } };
+static const struct led_effect e_grey = { s_grey, 1, true };
+static const struct led_effect e_warm = { s_warm, 1, true };
+static const struct led_effect e_blue = { s_blue, 1, true };
+static const struct led_effect e_add  = { s_add,  1, true };
+static const struct led_effect e_tint = { s_tint, 1, true };
+static const struct led_effect e_half = { s_half, 1, true };
+
+ZTEST(led_arbiter, test_blend_alpha)
+{
+	struct led_arbiter a;
+
+	led_arbiter_init(&a);
+	led_arbiter_set(&a, L_CHARGE, &e_charge, 0, 0);
+	led_arbiter_set_blend(&a, L_BLE, LED_BLEND_ALPHA, 128);
+	led_arbiter_set(&a, L_BLE, &e_blue, 0, 0);
+
+	zassert_true(eq(led_arbiter_render(&a, 0), C(127, 64, 128)), "half blue over orange");
+	zassert_equal(led_arbiter_active(&a, 0), L_BLE, "overlay is topmost");
+}
+
+ZTEST(led_arbiter, test_blend_add_saturates)
+{
+	struct led_arbiter a;
+
+	led_arbiter_init(&a);
+	led_arbiter_set(&a, L_TRACK, &e_grey, 0, 0);
+	led_arbiter_set_blend(&a, L_BLE, LED_BLEND_ADD, 255);
+	led_arbiter_set(&a, L_BLE, &e_add, 0, 0);
+
+	zassert_true(eq(led_arbiter_render(&a, 0), C(255, 150, 100)), "additive, clamped");
+}
+
+ZTEST(led_arbiter, test_blend_multiply_and_scale)
+{
+	struct led_arbiter a;
+
+	led_arbiter_init(&a);
+	led_arbiter_set(&a, L_TRACK, &e_warm, 0, 0);
+	led_arbiter_set_blend(&a, L_BLE, LED_BLEND_MULTIPLY, 255);
+	led_arbiter_set(&a, L_BLE, &e_tint, 0, 0);
+	zassert_true(eq(led_arbiter_render(&a, 0), C(100, 100, 0)), "multiply tints");
+
+	led_arbiter_clear(&a, L_BLE);
+	led_arbiter_set_blend(&a, L_ERROR, LED_BLEND_SCALE, 255);
+	led_arbiter_set(&a, L_ERROR, &e_half, 0, 0);
+	zassert_true(eq(led_arbiter_render(&a, 0), C(100, 50, 25)), "scale halves brightness");
+}
+
+ZTEST(led_arbiter, test_blend_stops_at_opaque_layer)
+{
+	struct led_arbiter a;
+
+	led_arbiter_init(&a);
+
+	/* An additive layer with nothing below composites onto black. */
+	led_arbiter_set_blend(&a, L_TRACK, LED_BLEND_ADD, 255);
+	led_arbiter_set(&a, L_TRACK, &e_add, 0, 0);
+	zassert_true(eq(led_arbiter_render(&a, 0), C(200, 50, 0)), "add onto black");
+
+	/* An opaque layer above hides it; the blend mode outlives clear/set. */
+	led_arbiter_set(&a, L_CHARGE, &e_charge, 0, 0);
+	zassert_true(eq(led_arbiter_render(&a, 0), C(255, 128, 0)), "opaque hides below");
+
+	led_arbiter_clear(&a, L_CHARGE);
+	led_arbiter_clear(&a, L_TRACK);
+	led_arbiter_set(&a, L_TRACK, &e_add, 0, 0);
+	led_arbiter_set(&a, L_BLE, &e_grey, 0, 0);
+	zassert_true(eq(led_arbiter_render(&a, 0), C(100, 100, 100)), "opaque on top");
+}
+
+ZTEST(led_arbiter, test_top_and_bottom_layers)
+{
+	struct led_arbiter a;
+	const uint8_t top = LED_ARBITER_MAX_LAYERS - 1;
+
+	led_arbiter_init(&a);
+	led_arbiter_set(&a, 0, &e_track, 0, 0);
+	led_arbiter_set(&a, top, &e_ble_once, 0, 0);
+	zassert_equal(led_arbiter_active(&a, 50), top, "top layer wins");
+	zassert_true(eq(led_arbiter_render(&a, 50), C(0, 0, 255)), "top layer shown");
+
+	/* the run-once top layer finishes: active() sees it without mutating */
+	zassert_equal(led_arbiter_active(&a, 250), 0, "falls through to layer 0");
+	zassert_true(eq(led_arbiter_render(&a, 250), C(0, 255, 0)), "layer 0 shown");
+
+	led_arbiter_set(&a, 0, NULL, 300, 0);
+	zassert_equal(led_arbiter_active(&a, 300), -1, "NULL effect clears the layer");
+}
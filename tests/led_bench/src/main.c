@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * LED engine micro-benchmarks. Prints one machine-readable line per result:
+ *
+ *   BENCH,<function>,<variant>,<param>,<ns_per_call>
+ *   TICKS,<mix>,<ticks_per_min>,<changes_per_min>
+ *   RAM,<file>,<relocated_text_bytes>
+ *
+ * Under QEMU icount the ns figure is an instruction count in disguise (2 ns per
+ * instruction at shift 1), so runs are comparable across hosts. TICKS replays
+ * rgb_led's tick policy (re-arm every RGB_LED_TICK_MS while a layer is live,
+ * kick on every set) over one simulated minute: ticks = wakeups, changes = the
+ * ticks that actually moved the output. RAM is what CONFIG_CODE_DATA_RELOCATION
+ * (the nrfmodule.led.bench.ramfunc scenario) copies into RAM; 0 when off.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <led/led_arbiter.h>
+
+#define ITERATIONS   (2000)
+#define MAX_STEPS    (256)
+#define TICK_MS      (40)    /* RGB_LED_TICK_MS in rgb_led.c */
+#define MINUTE_MS    (60000)
+
+#define C(r_, g_, b_) ((struct led_color){ .r = (r_), .g = (g_), .b = (b_) })
+
+static struct led_effect_step steps[MAX_STEPS];
+static uint32_t step_ends[MAX_STEPS];
+static volatile uint32_t sink; /* keeps results live */
+
+#if defined(CONFIG_CODE_DATA_RELOCATION)
+/* Emitted by the relocation linker script for region RAM. */
+extern char __ram_text_reloc_start[];
+extern char __ram_text_reloc_end[];
+#endif
+
+/* Alternating fade/hold steps, 10 ms per substep, plus their running sums. */
+static void build_steps(void)
+{
+	uint32_t acc = 0;
+
+	for (int i = 0; i < MAX_STEPS; i++) {
+		steps[i].color = C(i & 0xFF, 255 - (i & 0xFF), (i * 7) & 0xFF);
+		steps[i].substep_count = (i % 2) ? 8 : 1;
+		steps[i].substep_time_ms = 10;
+		acc += (uint32_t)steps[i].substep_count * steps[i].substep_time_ms;
+		step_ends[i] = acc;
+	}
+}
+
+static uint32_t ns_per_call(uint32_t start, uint32_t end)
+{
+	return (uint32_t)(k_cyc_to_ns_floor64(end - start) / ITERATIONS);
+}
+
+static uint32_t bench_effect(const struct led_effect *e)
+{
+	const uint32_t total = led_effect_duration_ms(e);
+	const uint32_t start = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		/* stride through the effect so every step position is sampled */
+		sink += led_effect_render(e, (i * 37U) % total, NULL).r;
+	}
+
+	return ns_per_call(start, k_cycle_get_32());
+}
+
+ZTEST_SUITE(led_bench, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(led_bench, test_effect_render)
+{
+	build_steps();
+	TC_PRINT("BENCH,function,variant,param,ns_per_call\n");
+
+	for (uint16_t n = 1; n <= MAX_STEPS; n *= 2) {
+		const struct led_effect summed = { steps, n, true };
+		const struct led_effect prefixed = { steps, n, true, step_ends };
+
+		TC_PRINT("BENCH,led_effect_render,summed,steps=%u,%u\n", n,
+			 bench_effect(&summed));
+		TC_PRINT("BENCH,led_effect_render,step_end_ms,steps=%u,%u\n", n,
+			 bench_effect(&prefixed));
+	}
+}
+
+ZTEST(led_bench, test_placement)
+{
+#if defined(CONFIG_CODE_DATA_RELOCATION)
+	const uintptr_t fn = (uintptr_t)led_effect_render & ~1U; /* drop the Thumb bit */
+
+	zassert_true(fn >= (uintptr_t)__ram_text_reloc_start &&
+		     fn < (uintptr_t)__ram_text_reloc_end, "led_effect_render not in RAM");
+	TC_PRINT("RAM,led_effect.c,%u\n",
+		 (unsigned int)(__ram_text_reloc_end - __ram_text_reloc_start));
+#else
+	TC_PRINT("RAM,led_effect.c,0\n");
+#endif
+}
+
+ZTEST(led_bench, test_arbiter)
+{
+	const struct led_effect e = { steps, 8, true, step_ends };
+	struct led_arbiter a;
+
+	build_steps();
+
+	for (int n = 1; n <= LED_ARBITER_MAX_LAYERS; n *= 2) {
+		led_arbiter_init(&a);
+		for (int l = 0; l < n; l++) {
+			led_arbiter_set(&a, (uint8_t)l, &e, 0, 0);
+		}
+
+		uint32_t start = k_cycle_get_32();
+
+		for (uint32_t i = 0; i < ITERATIONS; i++) {
+			sink += led_arbiter_render(&a, i * 13U).g;
+		}
+		TC_PRINT("BENCH,led_arbiter_render,opaque,layers=%d,%u\n", n,
+			 ns_per_call(start, k_cycle_get_32()));
+
+		start = k_cycle_get_32();
+		for (uint32_t i = 0; i < ITERATIONS; i++) {
+			sink += (uint32_t)led_arbiter_active(&a, i * 13U);
+		}
+		TC_PRINT("BENCH,led_arbiter_active,opaque,layers=%d,%u\n", n,
+			 ns_per_call(start, k_cycle_get_32()));
+
+		/* every layer above 0 blends, so the whole stack is composited */
+		for (int l = 1; l < n; l++) {
+			led_arbiter_set_blend(&a, (uint8_t)l, LED_BLEND_ALPHA, 128);
+		}
+		start = k_cycle_get_32();
+		for (uint32_t i = 0; i < ITERATIONS; i++) {
+			sink += led_arbiter_render(&a, i * 13U).g;
+		}
+		TC_PRINT("BENCH,led_arbiter_render,alpha,layers=%d,%u\n", n,
+			 ns_per_call(start, k_cycle_get_32()));
+	}
+}
+
+/* Typical mixes: a base layer plus the transients a product fires on it. */
+static const struct led_effect fx_solid   = LED_EFFECT_SOLID(LED_RGB(0, 255, 0));
+static const struct led_effect fx_breathe = LED_EFFECT_BREATHE(2000, LED_RGB(255, 128, 0));
+static const struct led_effect fx_flash   = LED_EFFECT_FLASH(80, 2000, LED_RGB(0, 0, 255));
+static const struct led_effect fx_ble     = LED_EFFECT_BLINK_N(3, 100, 100, LED_RGB(0, 0, 255));
+
+struct tick_mix {
+	const char *name;
+	const struct led_effect *base;      /**< layer 0, set at t=0; NULL = idle */
+	const struct led_effect *transient; /**< layer 1, re-fired every period */
+	uint32_t transient_period_ms;
+};
+
+static void count_ticks(const struct tick_mix *mix, uint32_t *ticks, uint32_t *changes)
+{
+	struct led_arbiter a;
+	struct led_color last = { 0, 0, 0 };
+	uint32_t next_fire = 0;
+	bool armed = false;
+
+	*ticks = 0;
+	*changes = 0;
+	led_arbiter_init(&a);
+	if (mix->base != NULL) {
+		led_arbiter_set(&a, 0, mix->base, 0, 0);
+		armed = true;
+	}
+
+	for (uint32_t t = 0; t < MINUTE_MS; t += TICK_MS) {
+		if (mix->transient != NULL && t >= next_fire) {
+			led_arbiter_set(&a, 1, mix->transient, t, 0);
+			next_fire += mix->transient_period_ms;
+			armed = true; /* rgb_led_set() kicks the tick */
+		}
+		if (!armed) {
+			continue;
+		}
+
+		const struct led_color c = led_arbiter_render(&a, t);
+
+		(*ticks)++;
+		if (c.r != last.r || c.g != last.g || c.b != last.b) {
+			(*changes)++;
+			last = c;
+		}
+		armed = led_arbiter_active(&a, t) >= 0;
+	}
+}
+
+ZTEST(led_bench, test_ticks_per_minute)
+{
+	static const struct tick_mix mixes[] = {
+		{ "idle",          NULL,        NULL,    0 },
+		{ "solid",         &fx_solid,   NULL,    0 },
+		{ "breathe",       &fx_breathe, NULL,    0 },
+		{ "flash",         &fx_flash,   NULL,    0 },
+		{ "idle+ble_10s",  NULL,        &fx_ble, 10000 },
+		{ "breathe+ble_10s", &fx_breathe, &fx_ble, 10000 },
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(mixes); i++) {
+		uint32_t ticks;
+		uint32_t changes;
+
+		count_ticks(&mixes[i], &ticks, &changes);
+		TC_PRINT("TICKS,%s,%u,%u\n", mixes[i].name, ticks, changes);
+		zassert_true(changes <= ticks, "%s: changes <= ticks", mixes[i].name);
+	}
+}
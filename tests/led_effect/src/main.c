@@ -151,3 +151,29 @@ ZTEST(led_effect, test_duration)
 	zassert_equal(led_effect_duration_ms(&e), 3 * 100 + 1 * 200, "total duration");
 	zassert_equal(led_effect_duration_ms(NULL), 0, "NULL duration 0");
 }
+
+ZTEST(led_effect, test_step_end_sums_match_summed_render)
+{
+	/* Fade, an empty step, then a hold — the generated-table shape. */
+	static const struct led_effect_step steps[] = {
+		{ .color = C(255, 0, 0), .substep_count = 10, .substep_time_ms = 20 },
+		{ .color = C(0, 255, 0), .substep_count = 1,  .substep_time_ms = 0 },
+		{ .color = C(0, 0, 255), .substep_count = 1,  .substep_time_ms = 300 },
+		{ .color = C(9, 9, 9),   .substep_count = 4,  .substep_time_ms = 25 },
+	};
+	static const uint32_t ends[] = { 200, 200, 500, 600 };
+	struct led_effect summed = { steps, 4, false };
+	struct led_effect prefixed = { steps, 4, false, ends };
+
+	zassert_equal(led_effect_duration_ms(&prefixed), 600, "duration from sums");
+
+	for (uint32_t t = 0; t < 700; t += 7) {
+		bool done_a = false;
+		bool done_b = false;
+		struct led_color a = led_effect_render(&summed, t, &done_a);
+		struct led_color b = led_effect_render(&prefixed, t, &done_b);
+
+		zassert_true(color_eq(a, b), "same colour at t=%u", t);
+		zassert_equal(done_a, done_b, "same done at t=%u", t);
+	}
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <power/rail_policy.h>
+
+/* livetracker sensor_pwr: 50 ms switch + POR settle. */
+static const struct rail_policy_cfg cfg = { .horizon_ms = 100, .settle_ms = 50 };
+
+#define BARO_REINIT_MS  (3)
+#define ACCEL_REINIT_MS (20)
+
+ZTEST_SUITE(rail_policy, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(rail_policy, test_holder_keeps_on)
+{
+	struct rail_plan p = rail_policy_plan(&cfg, false, 1, NULL, 0, 1000);
+
+	zassert_true(p.on);
+	zassert_equal(p.eval_at_ms, RAIL_NEVER);
+}
+
+ZTEST(rail_policy, test_idle_gates)
+{
+	const struct rail_need needs[] = {
+		{ .at_ms = RAIL_NEVER, .reinit_ms = BARO_REINIT_MS },
+	};
+	struct rail_plan p = rail_policy_plan(&cfg, true, 0, needs, ARRAY_SIZE(needs), 1000);
+
+	zassert_false(p.on);
+	zassert_equal(p.eval_at_ms, RAIL_NEVER);
+}
+
+ZTEST(rail_policy, test_lingers_for_close_need)
+{
+	/* Next read in 90 ms: within horizon + reinit, cheaper to stay on. */
+	const struct rail_need needs[] = {
+		{ .at_ms = 1090, .reinit_ms = BARO_REINIT_MS },
+	};
+	struct rail_plan p = rail_policy_plan(&cfg, true, 0, needs, ARRAY_SIZE(needs), 1000);
+
+	zassert_true(p.on);
+	zassert_equal(p.eval_at_ms, 1090 + 100 + 1, "held until the need goes stale");
+}
+
+ZTEST(rail_policy, test_reinit_cost_widens_linger)
+{
+	/* 110 ms out: too far for the baro, but the accel's re-init makes the
+	 * gap worth bridging. */
+	const struct rail_need baro[] = { { .at_ms = 1110, .reinit_ms = BARO_REINIT_MS } };
+	const struct rail_need accel[] = { { .at_ms = 1110, .reinit_ms = ACCEL_REINIT_MS } };
+
+	zassert_false(rail_policy_plan(&cfg, true, 0, baro, 1, 1000).on);
+	zassert_true(rail_policy_plan(&cfg, true, 0, accel, 1, 1000).on);
+}
+
+ZTEST(rail_policy, test_gates_and_prewarms_for_far_need)
+{
+	const struct rail_need needs[] = {
+		{ .at_ms = 2000, .reinit_ms = ACCEL_REINIT_MS },
+	};
+	struct rail_plan p = rail_policy_plan(&cfg, true, 0, needs, ARRAY_SIZE(needs), 1000);
+
+	zassert_false(p.on);
+	zassert_equal(p.eval_at_ms, 2000 - 50 - ACCEL_REINIT_MS, "wake at settle + reinit ahead");
+
+	/* At the pre-warm time the rail comes back on. */
+	p = rail_policy_plan(&cfg, false, 0, needs, ARRAY_SIZE(needs), p.eval_at_ms);
+	zassert_true(p.on);
+
+	/* Off, a need inside the horizon but before its lead time waits. */
+	p = rail_policy_plan(&cfg, false, 0, needs, ARRAY_SIZE(needs), 1900);
+	zassert_false(p.on);
+}
+
+ZTEST(rail_policy, test_close_needs_share_window)
+{
+	/* Baro at 2000, accel at 2060: one window covers both. */
+	const struct rail_need needs[] = {
+		{ .at_ms = 2000, .reinit_ms = BARO_REINIT_MS },
+		{ .at_ms = 2060, .reinit_ms = ACCEL_REINIT_MS },
+	};
+	struct rail_plan p;
+
+	/* Off: woken for the earlier of the two lead times (baro's). */
+	p = rail_policy_plan(&cfg, false, 0, needs, ARRAY_SIZE(needs), 1000);
+	zassert_false(p.on);
+	zassert_equal(p.eval_at_ms, 2000 - 50 - BARO_REINIT_MS);
+
+	/* Baro claimed and released at 2001: the accel need keeps it on. */
+	const struct rail_need after[] = {
+		{ .at_ms = RAIL_NEVER, .reinit_ms = BARO_REINIT_MS },
+		{ .at_ms = 2060, .reinit_ms = ACCEL_REINIT_MS },
+	};
+
+	p = rail_policy_plan(&cfg, true, 0, after, ARRAY_SIZE(after), 2001);
+	zassert_true(p.on);
+}
+
+ZTEST(rail_policy, test_missed_need_goes_stale)
+{
+	const struct rail_need needs[] = {
+		{ .at_ms = 1000, .reinit_ms = BARO_REINIT_MS },
+	};
+
+	zassert_true(rail_policy_plan(&cfg, true, 0, needs, 1, 1100).on);
+	zassert_false(rail_policy_plan(&cfg, true, 0, needs, 1, 1101).on,
+		      "never claimed: does not pin the rail");
+}
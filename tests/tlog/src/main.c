@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * tlog on the flash simulator: four 1 KB sectors, 256-byte staging.
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/storage/flash_map.h>
+#include <storage/tlog.h>
+
+#define TLOG_AREA FIXED_PARTITION_ID(tlog_partition)
+
+static struct tlog tl;
+static const struct flash_area *fa;
+static uint8_t rd[128];
+
+/* Payload of record seq: len bytes counting up from seq. */
+static void fill(uint8_t *buf, uint32_t seq, uint16_t len)
+{
+	for (uint16_t i = 0; i < len; i++) {
+		buf[i] = (uint8_t)(seq + i);
+	}
+}
+
+static int append(uint16_t len)
+{
+	uint8_t buf[128];
+
+	fill(buf, tlog_next_seq(&tl), len);
+	return tlog_append(&tl, buf, len);
+}
+
+static bool record_ok(uint32_t seq, uint16_t len)
+{
+	uint8_t want[128];
+
+	fill(want, seq, len);
+	return tlog_read(&tl, seq, rd, sizeof(rd)) == len && memcmp(rd, want, len) == 0;
+}
+
+/* Flash offset (within the area) where the next flushed record goes. */
+static off_t append_point(void)
+{
+	return (off_t)tl.head * tl.sector_size + tl.head_off;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	zassert_ok(flash_area_open(TLOG_AREA, &fa));
+	zassert_ok(flash_area_erase(fa, 0, fa->fa_size));
+	zassert_ok(tlog_init(&tl, TLOG_AREA));
+}
+
+ZTEST_SUITE(tlog, NULL, NULL, before, NULL, NULL);
+
+ZTEST(tlog, test_append_read)
+{
+	zassert_equal(tl.sector_count, 4);
+	zassert_equal(tlog_oldest_seq(&tl), 0);
+	zassert_equal(tlog_next_seq(&tl), 0);
+
+	for (int i = 0; i < 20; i++) {
+		zassert_ok(append(40));
+	}
+	zassert_equal(tlog_read(&tl, 20, rd, sizeof(rd)), -ENODATA);
+
+	/* In order (cursor), then out of order (index lookup). */
+	for (uint32_t seq = 0; seq < 20; seq++) {
+		zassert_true(record_ok(seq, 40), "seq %u", seq);
+	}
+	zassert_true(record_ok(13, 40));
+	zassert_true(record_ok(2, 40));
+
+	zassert_equal(tlog_read(&tl, 5, rd, 39), -ENOBUFS);
+	zassert_equal(tlog_append(&tl, rd, TLOG_REC_MAX_LEN + 1), -EMSGSIZE);
+}
+
+ZTEST(tlog, test_full_stage_writes_whole_pages)
+{
+	/* 52-byte records: the ninth overflows the 256-byte stage while the
+	 * staged ones straddle the first page boundary. */
+	for (int i = 0; i < 9; i++) {
+		zassert_ok(append(40));
+	}
+
+	zassert_true(tl.stage_len > 0, "tail kept staged");
+	zassert_equal((fa->fa_off + append_point()) % 256, 0, "only whole pages written");
+	zassert_equal(tl.stage_len + tl.head_off, 16 + 9 * 52, "nothing lost");
+	zassert_true(record_ok(8, 40));
+}
+
+ZTEST(tlog, test_remount)
+{
+	for (int i = 0; i < 30; i++) {
+		zassert_ok(append(24));
+	}
+	zassert_ok(tlog_flush(&tl));
+	zassert_ok(append(24)); /* staged only: lost on remount */
+
+	zassert_ok(tlog_init(&tl, TLOG_AREA));
+	zassert_equal(tlog_oldest_seq(&tl), 0);
+	zassert_equal(tlog_next_seq(&tl), 30);
+	zassert_true(record_ok(0, 24));
+	zassert_true(record_ok(29, 24));
+	zassert_equal(tlog_read(&tl, 30, rd, sizeof(rd)), -ENODATA);
+
+	zassert_ok(append(24));
+	zassert_true(record_ok(30, 24), "appends continue after the last record");
+}
+
+ZTEST(tlog, test_wrap_drops_oldest)
+{
+	uint32_t oldest;
+	uint16_t ahead;
+
+	/* 112-byte records, nine per sector: 60 go round the ring. */
+	for (int i = 0; i < 60; i++) {
+		zassert_ok(append(100));
+	}
+	zassert_ok(tlog_flush(&tl));
+
+	oldest = tlog_oldest_seq(&tl);
+	zassert_true(oldest > 0, "oldest sector dropped");
+	zassert_equal(tlog_read(&tl, oldest - 1, rd, sizeof(rd)), -ENOENT);
+	for (uint32_t seq = oldest; seq < 60; seq++) {
+		zassert_true(record_ok(seq, 100), "seq %u", seq);
+	}
+
+	ahead = (tl.head + 1) % tl.sector_count;
+	zassert_equal(tl.index[ahead].gen, 0, "sector after the head erased ahead");
+
+	zassert_ok(tlog_init(&tl, TLOG_AREA));
+	zassert_equal(tlog_oldest_seq(&tl), oldest);
+	zassert_equal(tlog_next_seq(&tl), 60);
+	zassert_true(record_ok(59, 100));
+}
+
+ZTEST(tlog, test_torn_header)
+{
+	const uint8_t garbage[12] = { 0x12, 0x34, 0x56, 0x78, 0, 0, 0, 0, 0, 0, 0, 0 };
+	uint16_t head;
+
+	for (int i = 0; i < 5; i++) {
+		zassert_ok(append(20));
+	}
+	zassert_ok(tlog_flush(&tl));
+	head = tl.head;
+
+	/* A cut while the next header was being programmed. */
+	zassert_ok(flash_area_write(fa, append_point(), garbage, sizeof(garbage)));
+
+	zassert_ok(tlog_init(&tl, TLOG_AREA));
+	zassert_equal(tlog_next_seq(&tl), 5);
+	for (uint32_t seq = 0; seq < 5; seq++) {
+		zassert_true(record_ok(seq, 20));
+	}
+
+	zassert_ok(append(20));
+	zassert_ok(tlog_flush(&tl));
+	zassert_not_equal(tl.head, head, "sealed sector: appends move on");
+	zassert_true(record_ok(5, 20));
+}
+
+ZTEST(tlog, test_torn_payload)
+{
+	struct tlog_rec_hdr hdr = {
+		.magic = TLOG_REC_MAGIC,
+		.len = 40,
+		.seq = 5,
+		.crc = 0,
+	};
+	const uint8_t partial[8] = { 5, 6, 7, 8, 9, 10, 11, 12 };
+	off_t at;
+
+	for (int i = 0; i < 5; i++) {
+		zassert_ok(append(20));
+	}
+	zassert_ok(tlog_flush(&tl));
+
+	/* Header made it, the payload only partly. */
+	at = append_point();
+	zassert_ok(flash_area_write(fa, at, &hdr, sizeof(hdr)));
+	zassert_ok(flash_area_write(fa, at + sizeof(hdr), partial, sizeof(partial)));
+
+	zassert_ok(tlog_init(&tl, TLOG_AREA));
+	zassert_equal(tlog_next_seq(&tl), 6, "torn record keeps its seq");
+	zassert_equal(tlog_read(&tl, 5, rd, sizeof(rd)), -EBADMSG);
+	zassert_true(record_ok(4, 20));
+
+	zassert_ok(append(20));
+	zassert_true(record_ok(6, 20), "appended after the torn record");
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <string.h>
+#include <storage/tlog_format.h>
+
+static uint8_t buf[64];
+
+ZTEST_SUITE(tlog_format, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(tlog_format, test_record_roundtrip)
+{
+	static const uint8_t payload[] = { 1, 2, 3, 4, 5 };
+	struct tlog_rec_hdr hdr;
+	size_t n;
+
+	n = tlog_rec_encode(buf, sizeof(buf), 42, payload, sizeof(payload));
+	zassert_equal(n, sizeof(struct tlog_rec_hdr) + 8, "padded to a word");
+	zassert_equal(n, tlog_rec_size(sizeof(payload)));
+
+	memcpy(&hdr, buf, sizeof(hdr));
+	zassert_true(tlog_rec_hdr_plausible(&hdr));
+	zassert_false(tlog_rec_hdr_erased(&hdr));
+	zassert_equal(hdr.seq, 42);
+	zassert_equal(hdr.len, sizeof(payload));
+	zassert_true(tlog_rec_crc_ok(&hdr, &buf[sizeof(hdr)]));
+	zassert_mem_equal(&buf[sizeof(hdr)], payload, sizeof(payload));
+	zassert_equal(buf[sizeof(hdr) + 5], 0xFF, "padding left erased");
+	zassert_equal(buf[sizeof(hdr) + 7], 0xFF);
+}
+
+ZTEST(tlog_format, test_record_corruption)
+{
+	static const uint8_t payload[] = { 0xde, 0xad, 0xbe, 0xef };
+	struct tlog_rec_hdr hdr;
+
+	zassert_not_equal(tlog_rec_encode(buf, sizeof(buf), 7, payload, sizeof(payload)), 0);
+	memcpy(&hdr, buf, sizeof(hdr));
+
+	/* A bit lost in the payload... */
+	buf[sizeof(hdr) + 2] &= ~0x10;
+	zassert_false(tlog_rec_crc_ok(&hdr, &buf[sizeof(hdr)]));
+	buf[sizeof(hdr) + 2] |= 0x10;
+
+	/* ...or in the seq is caught. */
+	hdr.seq ^= 1;
+	zassert_false(tlog_rec_crc_ok(&hdr, &buf[sizeof(hdr)]));
+}
+
+ZTEST(tlog_format, test_record_limits)
+{
+	struct tlog_rec_hdr hdr;
+
+	zassert_equal(tlog_rec_encode(buf, sizeof(buf), 0, buf, sizeof(buf)), 0,
+		      "does not fit the destination");
+	zassert_equal(tlog_rec_encode(buf, SIZE_MAX, 0, buf, TLOG_REC_MAX_LEN + 1), 0);
+
+	memset(&hdr, 0xFF, sizeof(hdr));
+	zassert_true(tlog_rec_hdr_erased(&hdr));
+	zassert_false(tlog_rec_hdr_plausible(&hdr));
+
+	hdr.magic = TLOG_REC_MAGIC;
+	hdr.len = TLOG_REC_MAX_LEN + 1;
+	zassert_false(tlog_rec_hdr_plausible(&hdr), "torn length rejected");
+}
+
+ZTEST(tlog_format, test_sector_header)
+{
+	struct tlog_sector_hdr hdr;
+
+	tlog_sector_hdr_init(&hdr, 3, 1000);
+	zassert_true(tlog_sector_hdr_valid(&hdr));
+
+	hdr.first_seq++;
+	zassert_false(tlog_sector_hdr_valid(&hdr));
+
+	memset(&hdr, 0xFF, sizeof(hdr));
+	zassert_false(tlog_sector_hdr_valid(&hdr), "erased sector");
+
+	tlog_sector_hdr_init(&hdr, 0, 0);
+	zassert_false(tlog_sector_hdr_valid(&hdr), "gen 0 is reserved");
+}
+
+ZTEST(tlog_format, test_index_linear)
+{
+	/* Fresh log: sectors 0..2 written, 3 erased ahead, 4..5 never used. */
+	const struct tlog_index_entry idx[] = {
+		{ 1, 0 }, { 2, 40 }, { 3, 80 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+	};
+
+	zassert_equal(tlog_index_oldest(idx, ARRAY_SIZE(idx)), 0);
+	zassert_equal(tlog_index_newest(idx, ARRAY_SIZE(idx)), 2);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 0), 0);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 39), 0);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 40), 1);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 79), 1);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 5000), 2, "head holds the newest");
+}
+
+ZTEST(tlog_format, test_index_wrapped)
+{
+	/* Wrapped ring: head is sector 1, sector 2 erased ahead, oldest is 3. */
+	const struct tlog_index_entry idx[] = {
+		{ 7, 300 }, { 8, 350 }, { 0, 0 }, { 4, 150 }, { 5, 200 }, { 6, 250 },
+	};
+
+	zassert_equal(tlog_index_oldest(idx, ARRAY_SIZE(idx)), 3);
+	zassert_equal(tlog_index_newest(idx, ARRAY_SIZE(idx)), 1);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 149), -1, "dropped by the wrap");
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 150), 3);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 260), 5);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 300), 0);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 349), 0);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 351), 1);
+}
+
+ZTEST(tlog_format, test_index_seq_wrap)
+{
+	/* Seq counter wraps past UINT32_MAX inside the ring. */
+	const struct tlog_index_entry idx[] = {
+		{ 1, UINT32_MAX - 10 }, { 2, 5 }, { 0, 0 },
+	};
+
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), UINT32_MAX), 0);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 2), 0);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 6), 1);
+}
+
+ZTEST(tlog_format, test_index_empty)
+{
+	const struct tlog_index_entry idx[4] = { 0 };
+
+	zassert_equal(tlog_index_oldest(idx, ARRAY_SIZE(idx)), -1);
+	zassert_equal(tlog_index_newest(idx, ARRAY_SIZE(idx)), -1);
+	zassert_equal(tlog_index_find(idx, ARRAY_SIZE(idx), 0), -1);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 nRFModule
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <power/wake_plan.h>
+
+ZTEST_SUITE(wake_plan, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(wake_plan, test_nothing_pending)
+{
+	const struct wake_req reqs[] = {
+		{ .at_ms = WAKE_NEVER, .slack_ms = 100 },
+		{ .at_ms = WAKE_NEVER, .slack_ms = 0 },
+	};
+	struct wake_plan p = wake_plan_next(reqs, ARRAY_SIZE(reqs));
+
+	zassert_equal(p.at_ms, WAKE_NEVER);
+	zassert_equal(p.served, 0);
+	zassert_equal(p.cause, -1);
+	zassert_equal(wake_plan_next(NULL, 0).cause, -1, "no clients");
+}
+
+ZTEST(wake_plan, test_earliest_deadline_wins)
+{
+	const struct wake_req reqs[] = {
+		{ .at_ms = 5000, .slack_ms = 0 },
+		{ .at_ms = 2000, .slack_ms = 0 },
+		{ .at_ms = 9000, .slack_ms = 0 },
+	};
+	struct wake_plan p = wake_plan_next(reqs, ARRAY_SIZE(reqs));
+
+	zassert_equal(p.at_ms, 2000);
+	zassert_equal(p.cause, 1);
+	zassert_equal(p.served, BIT(1), "no slack, nothing joins");
+}
+
+ZTEST(wake_plan, test_slack_joins_window)
+{
+	/* GNSS at 2000 sets the wake; the sensor read due at 2400 with 500 ms
+	 * of slack rides along, the LED at 2800 with 500 ms does not. */
+	const struct wake_req reqs[] = {
+		{ .at_ms = 2000, .slack_ms = 0 },
+		{ .at_ms = 2400, .slack_ms = 500 },
+		{ .at_ms = 2800, .slack_ms = 500 },
+	};
+	struct wake_plan p = wake_plan_next(reqs, ARRAY_SIZE(reqs));
+
+	zassert_equal(p.at_ms, 2000);
+	zassert_equal(p.cause, 0);
+	zassert_equal(p.served, BIT(0) | BIT(1));
+}
+
+ZTEST(wake_plan, test_window_edge_inclusive)
+{
+	const struct wake_req reqs[] = {
+		{ .at_ms = 1000, .slack_ms = 0 },
+		{ .at_ms = 1300, .slack_ms = 300 },
+		{ .at_ms = 1301, .slack_ms = 300 },
+	};
+
+	zassert_equal(wake_plan_next(reqs, ARRAY_SIZE(reqs)).served, BIT(0) | BIT(1));
+}
+
+ZTEST(wake_plan, test_tie_goes_to_lower_index)
+{
+	const struct wake_req reqs[] = {
+		{ .at_ms = 700, .slack_ms = 50 },
+		{ .at_ms = 700, .slack_ms = 0 },
+	};
+	struct wake_plan p = wake_plan_next(reqs, ARRAY_SIZE(reqs));
+
+	zassert_equal(p.cause, 0);
+	zassert_equal(p.served, BIT(0) | BIT(1));
+}
+
+ZTEST(wake_plan, test_due_now)
+{
+	const struct wake_req reqs[] = {
+		{ .at_ms = 1000, .slack_ms = 200 },
+		{ .at_ms = 1500, .slack_ms = 200 },
+		{ .at_ms = WAKE_NEVER, .slack_ms = UINT32_MAX },
+		{ .at_ms = 400, .slack_ms = 0 },
+	};
+
+	zassert_equal(wake_plan_due(reqs, ARRAY_SIZE(reqs), 799), BIT(3), "overdue counts");
+	zassert_equal(wake_plan_due(reqs, ARRAY_SIZE(reqs), 800), BIT(0) | BIT(3));
+	zassert_equal(wake_plan_due(reqs, ARRAY_SIZE(reqs), 1300), BIT(0) | BIT(1) | BIT(3));
+}
+
+/* Periodic clients re-posting one period after each run; counts wakes. */
+static uint32_t simulate(const uint32_t *period, const uint32_t *slack, size_t n,
+			 int64_t until_ms)
+{
+	struct wake_req reqs[8];
+	uint32_t wakes = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		reqs[i].at_ms = period[i];
+		reqs[i].slack_ms = slack[i];
+	}
+
+	for (;;) {
+		const struct wake_plan p = wake_plan_next(reqs, n);
+
+		if (p.at_ms > until_ms) {
+			return wakes;
+		}
+		wakes++;
+		for (size_t i = 0; i < n; i++) {
+			if (p.served & BIT(i)) {
+				reqs[i].at_ms = p.at_ms + period[i];
+			}
+		}
+	}
+}
+
+ZTEST(wake_plan, test_alignment_saves_wakes)
+{
+	/* Baro ~1 s, battery ~60 s, LED heartbeat ~5 s, GNSS ~10 s over an
+	 * hour; periods slightly off round numbers, as real timers drift. */
+	const uint32_t period[] = { 1000, 60007, 5003, 10009 };
+	const uint32_t tight[] = { 0, 0, 0, 0 };
+	const uint32_t loose[] = { 100, 30000, 1000, 1000 };
+	const int64_t hour = 3600 * 1000;
+
+	const uint32_t apart = simulate(period, tight, ARRAY_SIZE(period), hour);
+	const uint32_t shared = simulate(period, loose, ARRAY_SIZE(period), hour);
+
+	TC_PRINT("wakes per hour: %u independent, %u aligned\n", apart, shared);
+	zassert_true(apart > 3600 + 700, "phases drift apart without slack");
+	zassert_true(shared <= 3600 + 10, "others ride on the 1 s baro wake");
+}